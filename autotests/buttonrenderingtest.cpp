@@ -0,0 +1,513 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <KDecoration2/Decoration>
+#include <KDecoration2/DecorationButton>
+#include <KDecoration2/DecorationSettings>
+#include <KDecoration2/Private/DecoratedClientPrivate>
+#include <KDecoration2/Private/DecorationBridge>
+#include <KDecoration2/Private/DecorationSettingsPrivate>
+
+#include <KConfigGroup>
+#include <KPluginFactory>
+#include <KSharedConfig>
+
+#include <QAbstractAnimation>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHoverEvent>
+#include <QImage>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPluginLoader>
+#include <QStandardPaths>
+#include <QTest>
+#include <QTextStream>
+
+#include <algorithm>
+#include <memory>
+
+using KDecoration2::DecorationButtonType;
+
+namespace Breeze
+{
+
+    namespace
+    {
+
+        //* window with fixed state, enough for buttons to render
+        class MockClient: public KDecoration2::DecoratedClientPrivate
+        {
+            public:
+
+            MockClient( KDecoration2::DecoratedClient* client, KDecoration2::Decoration* decoration, bool active ):
+                DecoratedClientPrivate( client, decoration ),
+                m_active( active )
+            {}
+
+            bool isActive() const override { return m_active; }
+            QString caption() const override { return QStringLiteral( "Button rendering test" ); }
+            int desktop() const override { return 1; }
+            bool isOnAllDesktops() const override { return false; }
+            bool isShaded() const override { return false; }
+            QIcon icon() const override { return QIcon(); }
+            bool isMaximized() const override { return false; }
+            bool isMaximizedHorizontally() const override { return false; }
+            bool isMaximizedVertically() const override { return false; }
+            bool isKeepAbove() const override { return false; }
+            bool isKeepBelow() const override { return false; }
+
+            bool isCloseable() const override { return true; }
+            bool isMaximizeable() const override { return true; }
+            bool isMinimizeable() const override { return true; }
+            bool providesContextHelp() const override { return true; }
+            bool isModal() const override { return false; }
+            bool isShadeable() const override { return true; }
+            bool isMoveable() const override { return true; }
+            bool isResizeable() const override { return true; }
+
+            WId windowId() const override { return 0; }
+            WId decorationId() const override { return 0; }
+
+            int width() const override { return 400; }
+            int height() const override { return 300; }
+            QSize size() const override { return QSize( width(), height() ); }
+            QPalette palette() const override { return QPalette(); }
+            Qt::Edges adjacentScreenEdges() const override { return Qt::Edges(); }
+
+            //* breeze color scheme, so that rendering does not depend on the desktop the test runs on
+            QColor color( KDecoration2::ColorGroup group, KDecoration2::ColorRole role ) const override
+            {
+                const bool active( group == KDecoration2::ColorGroup::Active );
+                switch( role )
+                {
+                    case KDecoration2::ColorRole::Foreground: return active ? QColor( 35, 38, 39 ) : QColor( 112, 125, 138 );
+                    default: return active ? QColor( 227, 229, 231 ) : QColor( 239, 240, 241 );
+                }
+            }
+
+            void requestShowToolTip( const QString& ) override {}
+            void requestHideToolTip() override {}
+            void requestClose() override {}
+            void requestToggleMaximization( Qt::MouseButtons ) override {}
+            void requestMinimize() override {}
+            void requestContextHelp() override {}
+            void requestToggleOnAllDesktops() override {}
+            void requestToggleShade() override {}
+            void requestToggleKeepAbove() override {}
+            void requestToggleKeepBelow() override {}
+            void requestShowWindowMenu() override {}
+
+            private:
+
+            bool m_active;
+        };
+
+        //* decoration settings without any button in the title bar
+        class MockSettings: public KDecoration2::DecorationSettingsPrivate
+        {
+            public:
+
+            explicit MockSettings( KDecoration2::DecorationSettings* parent ):
+                DecorationSettingsPrivate( parent )
+            {}
+
+            bool isAlphaChannelSupported() const override { return true; }
+            bool isOnAllDesktopsAvailable() const override { return true; }
+            bool isCloseOnDoubleClickOnMenu() const override { return false; }
+            QVector<DecorationButtonType> decorationButtonsLeft() const override { return {}; }
+            QVector<DecorationButtonType> decorationButtonsRight() const override { return {}; }
+            KDecoration2::BorderSize borderSize() const override { return KDecoration2::BorderSize::Normal; }
+        };
+
+        //* bridge creating mock windows, active or not
+        class MockBridge: public KDecoration2::DecorationBridge
+        {
+            public:
+
+            //* active state of the next created window
+            bool active = true;
+
+            std::unique_ptr<KDecoration2::DecoratedClientPrivate> createClient( KDecoration2::DecoratedClient* client, KDecoration2::Decoration* decoration ) override
+            { return std::unique_ptr<KDecoration2::DecoratedClientPrivate>( new MockClient( client, decoration, active ) ); }
+
+            std::unique_ptr<KDecoration2::DecorationSettingsPrivate> settings( KDecoration2::DecorationSettings* parent ) override
+            { return std::unique_ptr<KDecoration2::DecorationSettingsPrivate>( new MockSettings( parent ) ); }
+        };
+
+        //* button styles, in configuration order
+        const char* const styleNames[] =
+        {
+            "plasma",
+            "gnome",
+            "macSierra",
+            "macDarkAurorae",
+            "sbeSierra",
+            "sbeSierraActive",
+            "sbeSierraInactive",
+            "sbeDarkAurorae",
+            "sbeDarkAuroraeActive",
+            "sbeDarkAuroraeInactive",
+            "sierraColorSymbols",
+            "darkAuroraeColorSymbols",
+            "sierraMonochromeSymbols",
+            "darkAuroraeMonochromeSymbols"
+        };
+
+        //* button types with a symbol. The menu button renders the window icon instead
+        const QVector<QPair<DecorationButtonType, const char*>> buttonTypes =
+        {
+            { DecorationButtonType::Close, "close" },
+            { DecorationButtonType::Maximize, "maximize" },
+            { DecorationButtonType::Minimize, "minimize" },
+            { DecorationButtonType::OnAllDesktops, "onAllDesktops" },
+            { DecorationButtonType::Shade, "shade" },
+            { DecorationButtonType::KeepBelow, "keepBelow" },
+            { DecorationButtonType::KeepAbove, "keepAbove" },
+            { DecorationButtonType::ContextHelp, "contextHelp" },
+            { DecorationButtonType::ApplicationMenu, "applicationMenu" }
+        };
+
+        //* button states
+        enum State
+        {
+            Normal,
+            Hovered,
+            Pressed,
+            Checked
+        };
+
+        const char* const stateNames[] = { "normal", "hovered", "pressed", "checked" };
+
+    }
+
+    //* renders every button style, type and state, and compares against reference images
+    class ButtonRenderingTest: public QObject
+    {
+
+        Q_OBJECT
+
+        private Q_SLOTS:
+
+        void initTestCase();
+        void cleanupTestCase();
+
+        void render_data();
+        void render();
+
+        private:
+
+        //* write button style to the configuration file and reload settings
+        void setButtonStyle( int );
+
+        //* decoration for the current style and given active state, created on first use
+        KDecoration2::Decoration* decoration( bool active );
+
+        //* render button once
+        static void paint( KDecoration2::DecorationButton*, QImage& );
+
+        //* number of pixels differing from reference by more than the tolerance
+        static int compare( const QImage&, const QImage& );
+
+        //*@name comparison tolerance
+        //@{
+        enum
+        {
+            //* maximum difference per channel, for antialiasing differences between Qt versions
+            ChannelTolerance = 16,
+
+            //* maximum number of pixels beyond channel tolerance, per thousand pixels
+            PixelTolerance = 5
+        };
+        //@}
+
+        //* number of renderings each timing is averaged over
+        enum { TimingIterations = 20 };
+
+        //* button size, in logical pixels
+        enum { ButtonSize = 24 };
+
+        //* decoration plugin
+        QPluginLoader m_loader;
+        KPluginFactory* m_factory = nullptr;
+
+        //*@name decoration environment
+        //@{
+        MockBridge m_bridge;
+        QSharedPointer<KDecoration2::DecorationSettings> m_settings;
+        //@}
+
+        //* current button style, or -1
+        int m_style = -1;
+
+        //* decorations for the current style, inactive and active
+        std::unique_ptr<KDecoration2::Decoration> m_decorations[2];
+
+        //* reference images
+        QDir m_referenceDir;
+
+        //* where rendered images are written when they do not match
+        QDir m_outputDir;
+
+        //* per combination render time, in microseconds
+        QStringList m_timings;
+
+    };
+
+    //________________________________________________________________
+    void ButtonRenderingTest::initTestCase()
+    {
+        // never touch the user configuration
+        QStandardPaths::setTestModeEnabled( true );
+        QFile::remove( QStandardPaths::writableLocation( QStandardPaths::GenericConfigLocation ) + QStringLiteral( "/roundedsbe.conf" ) );
+        QFile::remove( QStandardPaths::writableLocation( QStandardPaths::GenericCacheLocation ) + QStringLiteral( "/roundedsbe/settings.cache" ) );
+
+        // the plugin and reference directory are overridden when rendering references with the reference build
+        m_loader.setFileName( qEnvironmentVariable( "BREEZE_DECORATION_PLUGIN", QStringLiteral( PLUGIN_PATH ) ) );
+        m_factory = qobject_cast<KPluginFactory*>( m_loader.instance() );
+        QVERIFY2( m_factory, qPrintable( m_loader.errorString() ) );
+
+        m_settings = QSharedPointer<KDecoration2::DecorationSettings>::create( &m_bridge );
+
+        m_referenceDir = QDir( qEnvironmentVariable( "BREEZE_REFERENCE_DIR", QStringLiteral( REFERENCE_DIR ) ) );
+        if( qEnvironmentVariableIsSet( "BREEZE_UPDATE_REFERENCE_IMAGES" ) )
+        { QVERIFY( m_referenceDir.mkpath( QStringLiteral( "." ) ) ); }
+
+        m_outputDir = QDir( QDir::currentPath() );
+        m_outputDir.mkpath( QStringLiteral( "buttonrendering" ) );
+        m_outputDir.cd( QStringLiteral( "buttonrendering" ) );
+    }
+
+    //________________________________________________________________
+    void ButtonRenderingTest::cleanupTestCase()
+    {
+        m_decorations[0].reset();
+        m_decorations[1].reset();
+
+        QFile file( m_outputDir.filePath( QStringLiteral( "timings.csv" ) ) );
+        if( !file.open( QIODevice::WriteOnly|QIODevice::Truncate ) ) return;
+
+        QTextStream stream( &file );
+        stream << "style,type,state,window,scale,microseconds\n";
+        foreach( const QString& line, m_timings )
+        { stream << line << '\n'; }
+
+        qInfo() << "render times written to" << file.fileName();
+    }
+
+    //________________________________________________________________
+    void ButtonRenderingTest::render_data()
+    {
+        QTest::addColumn<int>( "style" );
+        QTest::addColumn<int>( "type" );
+        QTest::addColumn<int>( "state" );
+        QTest::addColumn<bool>( "active" );
+        QTest::addColumn<int>( "scale" );
+
+        // rows are grouped by style, so that settings are only reloaded once per style
+        for( int style = 0; style < int( sizeof( styleNames )/sizeof( styleNames[0] ) ); ++style )
+        {
+            foreach( const auto& type, buttonTypes )
+            {
+                for( int state = Normal; state <= Checked; ++state )
+                {
+                    for( const bool active : { true, false } )
+                    {
+                        for( const int scale : { 1, 2 } )
+                        {
+                            const QString name( QStringLiteral( "%1-%2-%3-%4@%5x" )
+                                .arg( QLatin1String( styleNames[style] ) )
+                                .arg( QLatin1String( type.second ) )
+                                .arg( QLatin1String( stateNames[state] ) )
+                                .arg( QLatin1String( active ? "active" : "inactive" ) )
+                                .arg( scale ) );
+
+                            QTest::newRow( qPrintable( name ) ) << style << int( type.first ) << state << active << scale;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //________________________________________________________________
+    void ButtonRenderingTest::render()
+    {
+        QFETCH( int, style );
+        QFETCH( int, type );
+        QFETCH( int, state );
+        QFETCH( bool, active );
+        QFETCH( int, scale );
+
+        if( style != m_style ) setButtonStyle( style );
+
+        auto d = decoration( active );
+        QVERIFY( d );
+
+        // standalone button, as created by panel applets
+        std::unique_ptr<KDecoration2::DecorationButton> button( m_factory->create<KDecoration2::DecorationButton>( d,
+            QVariantList( { QVariant::fromValue( DecorationButtonType( type ) ), QVariant::fromValue( d ) } ) ) );
+        QVERIFY( button );
+
+        const auto animations( button->findChildren<QAbstractAnimation*>() );
+        button->setGeometry( QRectF( 0, 0, ButtonSize, ButtonSize ) );
+        button->setVisible( true );
+        button->setEnabled( true );
+
+        const QPointF center( ButtonSize/2, ButtonSize/2 );
+        if( state == Hovered || state == Pressed )
+        {
+            QHoverEvent event( QEvent::HoverEnter, center, QPointF( -1, -1 ) );
+            QCoreApplication::sendEvent( button.get(), &event );
+            QVERIFY( button->isHovered() );
+        }
+
+        if( state == Pressed )
+        {
+            QMouseEvent event( QEvent::MouseButtonPress, center, Qt::LeftButton, Qt::LeftButton, Qt::NoModifier );
+            QCoreApplication::sendEvent( button.get(), &event );
+            QVERIFY( button->isPressed() );
+        }
+
+        if( state == Checked )
+        {
+            button->setCheckable( true );
+            button->setChecked( true );
+        }
+
+        // let the hover animation settle
+        QTRY_VERIFY( std::none_of( animations.begin(), animations.end(),
+            []( const QAbstractAnimation* animation ) { return animation->state() == QAbstractAnimation::Running; } ) );
+
+        QImage image( QSize( ButtonSize, ButtonSize )*scale, QImage::Format_ARGB32_Premultiplied );
+        image.setDevicePixelRatio( scale );
+
+        QElapsedTimer timer;
+        timer.start();
+        for( int i = 0; i < TimingIterations; ++i ) paint( button.get(), image );
+        const qint64 elapsed( timer.nsecsElapsed()/TimingIterations/1000 );
+
+        const QString name( QString::fromLatin1( QTest::currentDataTag() ) );
+        m_timings.append( QStringLiteral( "%1,%2" ).arg( QString( name ).replace( QLatin1Char( '-' ), QLatin1Char( ',' ) ).replace( QLatin1Char( '@' ), QLatin1Char( ',' ) ) ).arg( elapsed ) );
+
+        // references are only written on request
+        const QString referenceFile( m_referenceDir.filePath( name + QStringLiteral( ".png" ) ) );
+        if( qEnvironmentVariableIsSet( "BREEZE_UPDATE_REFERENCE_IMAGES" ) )
+        {
+            QVERIFY( image.save( referenceFile ) );
+            return;
+        }
+
+        QImage reference( referenceFile );
+        if( reference.isNull() )
+        {
+            const QString actualFile( m_outputDir.filePath( name + QStringLiteral( ".png" ) ) );
+            image.save( actualFile );
+            QFAIL( qPrintable( QStringLiteral( "missing reference image %1, see %2" ).arg( referenceFile ).arg( actualFile ) ) );
+        }
+
+        const int differences( compare( image, reference ) );
+        if( differences < 0 || differences*1000 > PixelTolerance*image.width()*image.height() )
+        {
+            const QString actualFile( m_outputDir.filePath( name + QStringLiteral( ".png" ) ) );
+            image.save( actualFile );
+            QFAIL( qPrintable( QStringLiteral( "%1 differs from reference in %2 pixels, see %3" ).arg( name ).arg( differences ).arg( actualFile ) ) );
+        }
+    }
+
+    //________________________________________________________________
+    void ButtonRenderingTest::setButtonStyle( int style )
+    {
+        // decorations are recreated, so that none keeps settings from the previous style
+        m_decorations[0].reset();
+        m_decorations[1].reset();
+
+        KSharedConfig::Ptr config( KSharedConfig::openConfig( QStringLiteral( "roundedsbe.conf" ) ) );
+        KConfigGroup group( config, QStringLiteral( "Windeco" ) );
+        group.writeEntry( "ButtonStyle", style );
+
+        // no hover animation to wait for, while keeping the animated symbol geometry
+        group.writeEntry( "AnimationsEnabled", true );
+        group.writeEntry( "AnimationsDuration", 1 );
+        config->sync();
+
+        // decorations reload settings when kwin reconfigures them
+        emit m_settings->reconfigured();
+
+        m_style = style;
+    }
+
+    //________________________________________________________________
+    KDecoration2::Decoration* ButtonRenderingTest::decoration( bool active )
+    {
+        auto& decoration( m_decorations[active ? 1:0] );
+        if( decoration ) return decoration.get();
+
+        m_bridge.active = active;
+        const QVariantMap args( { { QStringLiteral( "bridge" ), QVariant::fromValue( static_cast<KDecoration2::DecorationBridge*>( &m_bridge ) ) } } );
+        decoration.reset( m_factory->create<KDecoration2::Decoration>( nullptr, QVariantList( { args } ) ) );
+        if( !decoration ) return nullptr;
+
+        decoration->setSettings( m_settings );
+        decoration->init();
+        return decoration.get();
+    }
+
+    //________________________________________________________________
+    void ButtonRenderingTest::paint( KDecoration2::DecorationButton* button, QImage& image )
+    {
+        image.fill( Qt::transparent );
+        QPainter painter( &image );
+        button->paint( &painter, QRect( QPoint( 0, 0 ), image.size()/image.devicePixelRatio() ) );
+    }
+
+    //________________________________________________________________
+    int ButtonRenderingTest::compare( const QImage& image, const QImage& reference )
+    {
+        const QImage first( image.convertToFormat( QImage::Format_ARGB32 ) );
+        const QImage second( reference.convertToFormat( QImage::Format_ARGB32 ) );
+        if( first.size() != second.size() ) return -1;
+
+        int differences = 0;
+        for( int y = 0; y < first.height(); ++y )
+        {
+            const QRgb* line( reinterpret_cast<const QRgb*>( first.constScanLine( y ) ) );
+            const QRgb* referenceLine( reinterpret_cast<const QRgb*>( second.constScanLine( y ) ) );
+            for( int x = 0; x < first.width(); ++x )
+            {
+                const QRgb a( line[x] );
+                const QRgb b( referenceLine[x] );
+                if( qAbs( qRed( a ) - qRed( b ) ) > ChannelTolerance ||
+                    qAbs( qGreen( a ) - qGreen( b ) ) > ChannelTolerance ||
+                    qAbs( qBlue( a ) - qBlue( b ) ) > ChannelTolerance ||
+                    qAbs( qAlpha( a ) - qAlpha( b ) ) > ChannelTolerance )
+                { ++differences; }
+            }
+        }
+
+        return differences;
+    }
+
+}
+
+QTEST_MAIN( Breeze::ButtonRenderingTest )
+
+#include "buttonrenderingtest.moc"
@@ -0,0 +1,442 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezeexceptionlist.h"
+#include "breezeexceptionmatcher.h"
+#include "breezesettingscache.h"
+#include "breezesettingsprovider.h"
+#include "breezewindowclass.h"
+
+#include <KConfigGroup>
+#include <KSharedConfig>
+
+#include <QDebug>
+#include <QFile>
+#include <QRegularExpression>
+#include <QStandardPaths>
+#include <QStringList>
+#include <QTest>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    //* allocations made by the whole process, all threads included
+    std::atomic<qint64> s_allocations( 0 );
+}
+
+//* count allocations. Array forms and other libraries end up here as well
+void* operator new( std::size_t size )
+{
+    ++s_allocations;
+    if( void* pointer = std::malloc( size ? size : 1 ) ) return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete( void* pointer ) noexcept
+{ std::free( pointer ); }
+
+void operator delete( void* pointer, std::size_t ) noexcept
+{ std::free( pointer ); }
+
+namespace Breeze
+{
+
+    namespace
+    {
+
+        //* pattern shapes, one per matcher path
+        enum Kind
+        {
+            Exact,
+            Prefix,
+            Substring,
+            Regex
+        };
+
+        //* pattern of given shape, for rule i
+        QString pattern( Kind kind, int i )
+        {
+            switch( kind )
+            {
+                case Exact: return QStringLiteral( "^app%1 App%1$" ).arg( i );
+                case Prefix: return QStringLiteral( "^app%1 " ).arg( i );
+                case Substring: return QStringLiteral( "pp%1 App" ).arg( i );
+                case Regex:
+                default: return QStringLiteral( "^app%1 (App|Tool)%1$" ).arg( i );
+            }
+        }
+
+        //* window class names looked up. Half match some rule, half none
+        QStringList classNames( int rules )
+        {
+            QStringList names;
+            for( int i = 0; i < rules; i += qMax( 1, rules/32 ) )
+            {
+                names.append( QStringLiteral( "app%1 App%1" ).arg( i ) );
+                names.append( QStringLiteral( "other%1 Other%1" ).arg( i ) );
+            }
+
+            return names;
+        }
+
+        //* allocations made while running given function
+        template<typename Function>
+            qint64 allocations( Function function )
+        {
+            const qint64 start( s_allocations.load() );
+            function();
+            return s_allocations.load() - start;
+        }
+
+        //* NET window types, as stored in exception type masks
+        enum
+        {
+            NormalType = 0,
+            DialogType = 5
+        };
+
+        //* exception of mixed shape and criteria, for rule i
+        InternalSettingsPtr mixedException( const InternalSettings& defaults, int i )
+        {
+            InternalSettingsPtr exception( ExceptionList::createException( defaults ) );
+            exception->setEnabled( true );
+            switch( i%8 )
+            {
+                // class name patterns, one per matcher path
+                case 0: case 1: case 2: case 3:
+                exception->setExceptionPattern( pattern( Kind( i%4 ), i ) );
+                break;
+
+                case 4:
+                exception->setExceptionType( InternalSettings::ExceptionWindowTitle );
+                exception->setExceptionPattern( QStringLiteral( "Document %1 -" ).arg( i ) );
+                break;
+
+                case 5:
+                exception->setExceptionPattern( pattern( Exact, i ) );
+                exception->setIsDialog( true );
+                break;
+
+                case 6:
+                exception->setExceptionPattern( pattern( Prefix, i ) );
+                exception->setExceptionWindowRole( QStringLiteral( "role%1" ).arg( i ) );
+                exception->setExceptionWindowTypes( 1<<NormalType | 1<<DialogType );
+                break;
+
+                // criteria only, without pattern
+                case 7:
+                default:
+                exception->setExceptionDesktopFileName( QStringLiteral( "org.kde.app%1" ).arg( i ) );
+                exception->setExceptionTransient( InternalSettings::TransientNever );
+                break;
+            }
+
+            return exception;
+        }
+
+        //* write roundedsbe.conf with given number of mixed exceptions
+        void writeConfig( int rules )
+        {
+            InternalSettings defaults;
+            defaults.setCurrentGroup( QStringLiteral( "Windeco" ) );
+            defaults.load();
+
+            InternalSettingsList exceptions;
+            for( int i = 0; i < rules; ++i )
+            { exceptions.append( mixedException( defaults, i ) ); }
+
+            KSharedConfig::Ptr config( KSharedConfig::openConfig( QStringLiteral( "roundedsbe.conf" ) ) );
+            ExceptionList( exceptions ).writeConfig( config );
+            config->sync();
+        }
+
+        //* properties of synthetic window i. Windows spread over all rules, some match none
+        SettingsProvider::WindowProperties window( int i, int rules )
+        {
+            const int rule( ( i*7919 )%rules );
+
+            SettingsProvider::WindowProperties properties;
+            properties.className = ( i%4 == 3 ? QStringLiteral( "other%1 Other%1" ) : QStringLiteral( "app%1 App%1" ) ).arg( rule );
+            properties.classId = WindowClass::id( properties.className );
+            properties.caption = QStringLiteral( "Document %1 - Editor" ).arg( rule );
+            properties.type = i%5 == 0 ? SettingsProvider::WindowProperties::Dialog : SettingsProvider::WindowProperties::NotDialog;
+            properties.windowType = i%5 == 0 ? DialogType : NormalType;
+            properties.role = QStringLiteral( "role%1" ).arg( rule );
+            properties.desktopFileName = QStringLiteral( "org.kde.app%1" ).arg( rule );
+            properties.transient = i%3 == 0 ? SettingsProvider::WindowProperties::IsTransient : SettingsProvider::WindowProperties::NotTransient;
+            properties.known = SettingsProvider::WindowProperties::KnownRole | SettingsProvider::WindowProperties::KnownDesktopFileName;
+            return properties;
+        }
+
+    }
+
+    //* lookup time of the exception matcher, per pattern shape and number of rules
+    class ExceptionMatcherBenchmark: public QObject
+    {
+
+        Q_OBJECT
+
+        private Q_SLOTS:
+
+        //* use a private configuration, without settings cache
+        void initTestCase();
+
+        void match_data();
+        void match();
+
+        //* same rules matched one regular expression after the other, for comparison
+        void sequential_data();
+        void sequential();
+
+        //* parsing the configuration file, and reading exceptions from it
+        void readConfig_data();
+        void readConfig();
+
+        //* reconfigure with unchanged configuration, and with one exception edited between calls
+        void reconfigure_data();
+        void reconfigure();
+
+        //* settings lookup of each window, through the provider
+        void lookup_data();
+        void lookup();
+
+    };
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled( true );
+
+        // the snapshot written by the configuration module would bypass reading exceptions
+        QFile::remove( SettingsCache::fileName() );
+    }
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::match_data()
+    {
+        QTest::addColumn<int>( "kind" );
+        QTest::addColumn<int>( "rules" );
+
+        static const char* const kindNames[] = { "exact", "prefix", "substring", "regex" };
+        for( int kind = Exact; kind <= Regex; ++kind )
+        {
+            for( const int rules : { 10, 100, 1000 } )
+            { QTest::newRow( qPrintable( QStringLiteral( "%1-%2" ).arg( QLatin1String( kindNames[kind] ) ).arg( rules ) ) ) << kind << rules; }
+        }
+    }
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::match()
+    {
+        QFETCH( int, kind );
+        QFETCH( int, rules );
+
+        ExceptionMatcher matcher;
+        for( int i = 0; i < rules; ++i )
+        { QVERIFY( matcher.add( ExceptionMatcher::ClassName, pattern( Kind( kind ), i ) ) ); }
+        matcher.finalize();
+
+        const QStringList names( classNames( rules ) );
+        const auto accept = []( int ) { return true; };
+
+        // sanity check, so that the benchmark does not time a matcher that never matches
+        QCOMPARE( matcher.match( names.first(), QString(), accept ), 0 );
+        QCOMPARE( matcher.match( names.at( 1 ), QString(), accept ), -1 );
+
+        int matches = 0;
+        QBENCHMARK
+        {
+            foreach( const QString& name, names )
+            { if( matcher.match( name, QString(), accept ) >= 0 ) ++matches; }
+        }
+
+        QVERIFY( matches > 0 );
+    }
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::sequential_data()
+    { match_data(); }
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::sequential()
+    {
+        QFETCH( int, kind );
+        QFETCH( int, rules );
+
+        QVector<QRegularExpression> expressions;
+        for( int i = 0; i < rules; ++i )
+        {
+            expressions.append( QRegularExpression( pattern( Kind( kind ), i ) ) );
+            expressions.last().optimize();
+        }
+
+        const QStringList names( classNames( rules ) );
+
+        int matches = 0;
+        QBENCHMARK
+        {
+            foreach( const QString& name, names )
+            {
+                foreach( const QRegularExpression& expression, expressions )
+                {
+                    if( expression.match( name ).hasMatch() )
+                    {
+                        ++matches;
+                        break;
+                    }
+                }
+            }
+        }
+
+        QVERIFY( matches > 0 );
+    }
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::readConfig_data()
+    {
+        QTest::addColumn<int>( "rules" );
+        for( const int rules : { 10, 100, 1000, 5000 } )
+        { QTest::newRow( qPrintable( QString::number( rules ) ) ) << rules; }
+    }
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::readConfig()
+    {
+        QFETCH( int, rules );
+        writeConfig( rules );
+
+        KSharedConfig::Ptr config( KSharedConfig::openConfig( QStringLiteral( "roundedsbe.conf" ) ) );
+        InternalSettings defaults;
+        defaults.setCurrentGroup( QStringLiteral( "Windeco" ) );
+        defaults.load();
+
+        // same steps as SettingsProvider::reconfigure, when there is no settings cache
+        int count = 0;
+        const auto read = [&]()
+        {
+            config->reparseConfiguration();
+            ExceptionList exceptions;
+            exceptions.readConfig( config, &defaults );
+            count = exceptions.get().size();
+        };
+
+        qDebug() << "allocations:" << allocations( read );
+        QCOMPARE( count, rules );
+
+        QBENCHMARK { read(); }
+    }
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::reconfigure_data()
+    {
+        QTest::addColumn<int>( "rules" );
+        QTest::addColumn<bool>( "changed" );
+        for( const int rules : { 10, 100, 1000, 5000 } )
+        {
+            QTest::newRow( qPrintable( QStringLiteral( "unchanged-%1" ).arg( rules ) ) ) << rules << false;
+            QTest::newRow( qPrintable( QStringLiteral( "changed-%1" ).arg( rules ) ) ) << rules << true;
+        }
+    }
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::reconfigure()
+    {
+        QFETCH( int, rules );
+        QFETCH( bool, changed );
+        writeConfig( rules );
+
+        SettingsProvider* provider( SettingsProvider::self() );
+        provider->reconfigure();
+
+        // editing the first exception rebuilds the matcher and criteria index. Writing the file is timed along
+        KSharedConfig::Ptr config( KSharedConfig::openConfig( QStringLiteral( "roundedsbe.conf" ) ) );
+        KConfigGroup group( config, QStringLiteral( "Windeco Exception 0" ) );
+        bool edited = false;
+        const auto update = [&]()
+        {
+            if( changed )
+            {
+                edited = !edited;
+                group.writeEntry( "ExceptionWindowRole", edited ? QStringLiteral( "benchmark" ) : QString() );
+                config->sync();
+            }
+
+            provider->reconfigure();
+        };
+
+        qDebug() << "allocations:" << allocations( update );
+        if( changed ) QVERIFY( provider->changes() & SettingsProvider::ExceptionsChanged );
+
+        QBENCHMARK { update(); }
+    }
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::lookup_data()
+    {
+        QTest::addColumn<int>( "rules" );
+        QTest::addColumn<int>( "windows" );
+        for( const int rules : { 100, 1000, 5000 } )
+        {
+            for( const int windows : { 50, 500, 2000 } )
+            { QTest::newRow( qPrintable( QStringLiteral( "%1-%2" ).arg( rules ).arg( windows ) ) ) << rules << windows; }
+        }
+    }
+
+    //________________________________________________________________
+    void ExceptionMatcherBenchmark::lookup()
+    {
+        QFETCH( int, rules );
+        QFETCH( int, windows );
+        writeConfig( rules );
+
+        SettingsProvider* provider( SettingsProvider::self() );
+        provider->reconfigure();
+
+        QVector<SettingsProvider::WindowProperties> properties;
+        for( int i = 0; i < windows; ++i )
+        { properties.append( window( i, rules ) ); }
+
+        // resolved settings are memoized per thread. Past the memo size, lookups keep missing
+        int matches = 0;
+        const auto resolve = [&]()
+        {
+            matches = 0;
+            foreach( const SettingsProvider::WindowProperties& current, properties )
+            { if( provider->internalSettings( current ) != provider->defaultSettings() ) ++matches; }
+        };
+
+        const qint64 first( allocations( resolve ) );
+        const qint64 next( allocations( resolve ) );
+        qDebug() << "allocations per window, first lookup:" << qreal( first )/windows << "next lookups:" << qreal( next )/windows;
+
+        // sanity check, so that the benchmark does not time lookups that never match
+        QVERIFY( matches > 0 && matches < windows );
+
+        QBENCHMARK { resolve(); }
+    }
+
+}
+
+QTEST_GUILESS_MAIN( Breeze::ExceptionMatcherBenchmark )
+
+#include "exceptionmatcherbenchmark.moc"
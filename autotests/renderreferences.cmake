@@ -0,0 +1,31 @@
+# renders the button reference images with the decoration plugin of the reference build
+#
+# TEST_EXECUTABLE: button rendering test
+# PLUGIN_NAME: decoration plugin file name
+# REFERENCE_BUILD_DIR: build directory of the reference revision
+# REFERENCE_DIR: where reference images are written
+
+file(GLOB_RECURSE plugins "${REFERENCE_BUILD_DIR}/${PLUGIN_NAME}")
+list(FILTER plugins EXCLUDE REGEX "/CMakeFiles/")
+if(NOT plugins)
+    message(FATAL_ERROR "no ${PLUGIN_NAME} in ${REFERENCE_BUILD_DIR}")
+endif()
+list(GET plugins 0 plugin)
+
+# references are rendered from scratch, from the reference build directory
+file(REMOVE_RECURSE "${REFERENCE_DIR}")
+file(MAKE_DIRECTORY "${REFERENCE_DIR}")
+
+execute_process(
+    COMMAND ${CMAKE_COMMAND} -E env
+        QT_QPA_PLATFORM=offscreen
+        BREEZE_UPDATE_REFERENCE_IMAGES=1
+        BREEZE_DECORATION_PLUGIN=${plugin}
+        BREEZE_REFERENCE_DIR=${REFERENCE_DIR}
+        ${TEST_EXECUTABLE}
+    WORKING_DIRECTORY "${REFERENCE_BUILD_DIR}"
+    RESULT_VARIABLE result)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "rendering references with ${plugin} failed")
+endif()
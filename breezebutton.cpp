@@ -19,11 +19,13 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "breezebutton.h"
+#include "breezecolorramp.h"
 
 #include <KDecoration2/DecoratedClient>
 #include <KColorUtils>
 #include <KIconLoader>
 
+#include <QCache>
 #include <QPainter>
 #include <QPainterPath>
 
@@ -34,6 +36,102 @@ namespace Breeze
     using KDecoration2::ColorGroup;
     using KDecoration2::DecorationButtonType;
 
+    namespace
+    {
+
+        //* margin around cached icons, in logical pixels, so that antialiased strokes are not clipped
+        const int s_pixmapMargin = 2;
+
+        //* everything a rendered button icon depends on
+        struct ButtonPixmapKey
+        {
+            int style;
+            int type;
+            int frame;
+            uint flags;
+            QRgb titleBarColor;
+            QRgb fontColor;
+            QRgb warningColor;
+            QSize size;
+            qreal devicePixelRatio;
+        };
+
+        enum ButtonPixmapFlag
+        {
+            Hovered = 1<<0,
+            UnisonHovered = 1<<1,
+            Pressed = 1<<2,
+            Checked = 1<<3,
+            Animating = 1<<4,
+            Active = 1<<5,
+            AnimationsEnabled = 1<<6,
+            MatchColorForTitleBar = 1<<7,
+            SystemForegroundColor = 1<<8
+        };
+
+        bool operator == ( const ButtonPixmapKey& first, const ButtonPixmapKey& second )
+        {
+            return first.style == second.style
+                && first.type == second.type
+                && first.frame == second.frame
+                && first.flags == second.flags
+                && first.titleBarColor == second.titleBarColor
+                && first.fontColor == second.fontColor
+                && first.warningColor == second.warningColor
+                && first.size == second.size
+                && qFuzzyCompare( first.devicePixelRatio, second.devicePixelRatio );
+        }
+
+        uint qHash( const ButtonPixmapKey& key, uint seed = 0 )
+        {
+            uint hash = seed;
+            hash = 31*hash + uint( key.style );
+            hash = 31*hash + uint( key.type );
+            hash = 31*hash + uint( key.frame );
+            hash = 31*hash + key.flags;
+            hash = 31*hash + key.titleBarColor;
+            hash = 31*hash + key.fontColor;
+            hash = 31*hash + key.warningColor;
+            hash = 31*hash + uint( key.size.width() );
+            hash = 31*hash + uint( qRound( 100*key.devicePixelRatio ) );
+            return hash;
+        }
+
+        //* rendered icons, shared by all buttons of all decorations. Cost is in kilobytes
+        QCache<ButtonPixmapKey, QPixmap> g_sPixmapCache( 8*1024 );
+
+        //* everything a colorized application icon depends on
+        struct MenuIconKey
+        {
+            qint64 iconKey;
+            QRgb fontColor;
+            QSize size;
+            qreal devicePixelRatio;
+        };
+
+        bool operator == ( const MenuIconKey& first, const MenuIconKey& second )
+        {
+            return first.iconKey == second.iconKey
+                && first.fontColor == second.fontColor
+                && first.size == second.size
+                && qFuzzyCompare( first.devicePixelRatio, second.devicePixelRatio );
+        }
+
+        uint qHash( const MenuIconKey& key, uint seed = 0 )
+        {
+            uint hash = ::qHash( key.iconKey, seed );
+            hash = 31*hash + key.fontColor;
+            hash = 31*hash + uint( key.size.width() );
+            hash = 31*hash + uint( key.size.height() );
+            hash = 31*hash + uint( qRound( 100*key.devicePixelRatio ) );
+            return hash;
+        }
+
+        //* application icons, colorized with the decoration font color. Cost is in kilobytes
+        QCache<MenuIconKey, QPixmap> g_sMenuIconCache( 2*1024 );
+
+    }
+
 
     //__________________________________________________________________
     Button::Button(DecorationButtonType type, Decoration* decoration, QObject* parent)
@@ -57,16 +155,24 @@ namespace Breeze
         setIconSize(QSize( height, height ));
 
         // connections
-        connect(decoration->client().toStrongRef().data(), SIGNAL(iconChanged(QIcon)), this, SLOT(update()));
-        connect(decoration->settings().data(), &KDecoration2::DecorationSettings::reconfigured, this, &Button::reconfigure);
+        // hovered, pressed, checked and enabled state changes are already repainted by KDecoration2::DecorationButton
+        if( type == DecorationButtonType::Menu )
+        {
+            connect(decoration->client().toStrongRef().data(), &KDecoration2::DecoratedClient::iconChanged, this, [this]()
+            {
+                discardMenuIcon();
+                update();
+            });
+        }
+
         connect( this, &KDecoration2::DecorationButton::hoveredChanged, this, &Button::updateAnimationState );
 
-        if (decoration->objectName() == "applet-window-buttons") {
+        if (decoration->isAppletWindowButtons()) {
             connect( this, &Button::hoveredChanged, [=, this](bool hovered){
                     decoration->setButtonHovered(hovered);
                     });
         }
-        connect(decoration, SIGNAL(buttonHoveredChanged()), this, SLOT(update()));
+        connect(decoration, &Decoration::buttonHoveredChanged, this, &Button::updateUnisonHover);
 
         reconfigure();
 
@@ -77,9 +183,17 @@ namespace Breeze
         : Button(args.at(0).value<DecorationButtonType>(), args.at(1).value<Decoration*>(), parent)
     {
         m_flag = FlagStandalone;
+
+        // buttons managed by a decoration are reconfigured by it.
+        // The decoration is connected first, so its settings are already updated
+        connect(SettingsProvider::self(), &SettingsProvider::changed, this, &Button::reconfigure);
+
         //! icon size must return to !valid because it was altered from the default constructor,
         //! in Standalone mode the button is not using the decoration metrics but its geometry
         m_iconSize = QSize(-1, -1);
+
+        // rescale the icon only when the applet resizes the button
+        connect(this, &KDecoration2::DecorationButton::geometryChanged, this, [this](const QRectF &geometry) { m_iconSize = geometry.size().toSize(); });
     }
 
     //__________________________________________________________________
@@ -116,10 +230,6 @@ namespace Breeze
                 QObject::connect(d->client().toStrongRef().data(), &KDecoration2::DecoratedClient::shadeableChanged, b, &Breeze::Button::setVisible );
                 break;
 
-                case DecorationButtonType::Menu:
-                QObject::connect(d->client().toStrongRef().data(), &KDecoration2::DecoratedClient::iconChanged, b, [b]() { b->update(); });
-                break;
-
                 default: break;
             }
 
@@ -143,54 +253,24 @@ namespace Breeze
         if( m_flag == FlagFirstInList ) painter->translate( m_offset );
         else painter->translate( 0, m_offset.y() );
 
-        if( !m_iconSize.isValid() || isStandAlone() ) m_iconSize = geometry().size().toSize();
+        if( !m_iconSize.isValid() ) m_iconSize = geometry().size().toSize();
 
         // menu button
         if (type() == DecorationButtonType::Menu)
         {
 
-            const QRectF iconRect( geometry().topLeft(), 0.8*m_iconSize );
+            const QRect iconRect( QRectF( geometry().topLeft(), 0.8*m_iconSize ).toRect() );
             const qreal width( m_iconSize.width() );
             painter->translate( 0.1*width, 0.1*width );
-            if (auto deco =  qobject_cast<Decoration*>(decoration())) {
-              const QPalette activePalette = KIconLoader::global()->customPalette();
-              QPalette palette = decoration()->client().toStrongRef().data()->palette();
-              palette.setColor(QPalette::WindowText, deco->fontColor());
-              KIconLoader::global()->setCustomPalette(palette);
-              decoration()->client().toStrongRef().data()->icon().paint(painter, iconRect.toRect());
-              if (activePalette == QPalette()) {
-                KIconLoader::global()->resetPalette();
-              }    else {
-                KIconLoader::global()->setCustomPalette(palette);
-              }
-            } else {
-              decoration()->client().toStrongRef().data()->icon().paint(painter, iconRect.toRect());
-            }
 
-        } else {
+            const QPixmap pixmap( menuIconPixmap( iconRect.size(), painter->device()->devicePixelRatioF() ) );
+            if( !pixmap.isNull() ) painter->drawPixmap( iconRect.topLeft(), pixmap );
 
-            auto d = qobject_cast<Decoration*>( decoration() );
+        } else {
 
-            if ( d && d->internalSettings()->buttonStyle() == 0 )
-                drawIconPlasma( painter );
-            else if ( d && d->internalSettings()->buttonStyle() == 1 )
-                drawIconGnome( painter );
-            else if ( d && d->internalSettings()->buttonStyle() == 2 )
-                drawIconMacSierra( painter );
-            else if ( d && d->internalSettings()->buttonStyle() == 3 )
-                drawIconMacDarkAurorae( painter );
-            else if ( d && ( d->internalSettings()->buttonStyle() == 4 || d->internalSettings()->buttonStyle() == 5 || d->internalSettings()->buttonStyle() == 6 ) )
-                drawIconSBEsierra( painter );
-            else if ( d && ( d->internalSettings()->buttonStyle() == 7 || d->internalSettings()->buttonStyle() == 8 || d->internalSettings()->buttonStyle() == 9 ) )
-                drawIconSBEdarkAurorae( painter );
-            else if ( d && d->internalSettings()->buttonStyle() == 10 )
-                drawIconSierraColorSymbols( painter );
-            else if ( d && d->internalSettings()->buttonStyle() == 11 )
-                drawIconDarkAuroraeColorSymbols( painter );
-            else if ( d && d->internalSettings()->buttonStyle() == 12 )
-                drawIconSierraMonochromeSymbols( painter );
-            else if ( d && d->internalSettings()->buttonStyle() == 13 )
-                drawIconDarkAuroraeMonochromeSymbols( painter );
+            // hover animations only pick the nearest pre-rendered frame
+            const QPixmap pixmap( iconPixmap( painter->device()->devicePixelRatioF() ) );
+            if( !pixmap.isNull() ) painter->drawPixmap( geometry().topLeft() - QPointF( s_pixmapMargin, s_pixmapMargin ), pixmap );
 
         }
 
@@ -199,8 +279,115 @@ namespace Breeze
     }
 
     //__________________________________________________________________
-    void Button::drawIconPlasma( QPainter *painter ) const
+    void Button::clearPixmapCache()
     {
+        g_sPixmapCache.clear();
+        g_sMenuIconCache.clear();
+    }
+
+    //__________________________________________________________________
+    QPixmap Button::menuIconPixmap( const QSize& size, qreal devicePixelRatio ) const
+    {
+        auto c = decoration()->client().toStrongRef();
+        const QIcon icon( c->icon() );
+        if( icon.isNull() || size.isEmpty() ) return QPixmap();
+
+        auto d = qobject_cast<Decoration*>( decoration() );
+        const MenuIconKey key = { icon.cacheKey(), d ? d->fontColor().rgba() : 0, size, devicePixelRatio };
+        m_menuIconKey = key.iconKey;
+
+        if( const QPixmap* cached = g_sMenuIconCache.object( key ) ) return *cached;
+
+        QPixmap pixmap( size*devicePixelRatio );
+        pixmap.setDevicePixelRatio( devicePixelRatio );
+        pixmap.fill( Qt::transparent );
+
+        QPainter painter( &pixmap );
+        if( d )
+        {
+
+            // symbolic icons pick their color from the icon loader palette
+            const QPalette activePalette = KIconLoader::global()->customPalette();
+            QPalette palette = c->palette();
+            palette.setColor( QPalette::WindowText, d->fontColor() );
+            KIconLoader::global()->setCustomPalette( palette );
+            icon.paint( &painter, QRect( QPoint( 0, 0 ), size ) );
+            if( activePalette == QPalette() ) KIconLoader::global()->resetPalette();
+            else KIconLoader::global()->setCustomPalette( activePalette );
+
+        } else icon.paint( &painter, QRect( QPoint( 0, 0 ), size ) );
+        painter.end();
+
+        g_sMenuIconCache.insert( key, new QPixmap( pixmap ), qMax( 1, pixmap.width()*pixmap.height()*4/1024 ) );
+        return pixmap;
+    }
+
+    //__________________________________________________________________
+    void Button::discardMenuIcon()
+    {
+        if( !m_menuIconKey ) return;
+        foreach( const MenuIconKey& key, g_sMenuIconCache.keys() )
+        { if( key.iconKey == m_menuIconKey ) g_sMenuIconCache.remove( key ); }
+        m_menuIconKey = 0;
+    }
+
+    //__________________________________________________________________
+    QPixmap Button::iconPixmap( qreal devicePixelRatio ) const
+    {
+        auto d = qobject_cast<Decoration*>( decoration() );
+        if( !d ) return QPixmap();
+
+        const auto c = d->client().toStrongRef();
+        const auto internalSettings = d->internalSettings();
+
+        uint flags = 0;
+        if( isHovered() ) flags |= Hovered;
+        if( hovered() ) flags |= UnisonHovered;
+        if( isPressed() ) flags |= Pressed;
+        if( isChecked() ) flags |= Checked;
+        if( m_animation->state() == QAbstractAnimation::Running ) flags |= Animating;
+        if( c->isActive() ) flags |= Active;
+        if( internalSettings->animationsEnabled() ) flags |= AnimationsEnabled;
+        if( internalSettings->matchColorForTitleBar() ) flags |= MatchColorForTitleBar;
+        if( internalSettings->systemForegroundColor() ) flags |= SystemForegroundColor;
+
+        const ButtonPixmapKey key = {
+            internalSettings->buttonStyle(),
+            int( type() ),
+            qRound( m_opacity*( AnimationFrames - 1 ) ),
+            flags,
+            d->titleBarColor().rgba(),
+            d->fontColor().rgba(),
+            c->color( ColorGroup::Warning, ColorRole::Foreground ).rgba(),
+            m_iconSize,
+            devicePixelRatio };
+
+        if( const QPixmap* cached = g_sPixmapCache.object( key ) ) return *cached;
+
+        // render icon, with its top left corner at the pixmap margin
+        const QSize size( m_iconSize + QSize( 2*s_pixmapMargin, 2*s_pixmapMargin ) );
+        QPixmap pixmap( size*devicePixelRatio );
+        pixmap.setDevicePixelRatio( devicePixelRatio );
+        pixmap.fill( Qt::transparent );
+
+        QPainter painter( &pixmap );
+        painter.translate( QPointF( s_pixmapMargin, s_pixmapMargin ) - geometry().topLeft() );
+        drawIcon( &painter );
+        painter.end();
+
+        g_sPixmapCache.insert( key, new QPixmap( pixmap ), qMax( 1, pixmap.width()*pixmap.height()*4/1024 ) );
+        return pixmap;
+    }
+
+    //__________________________________________________________________
+    void Button::drawIcon( QPainter *painter ) const
+    {
+
+        auto d = qobject_cast<Decoration*>( decoration() );
+        if( !d ) return;
+
+        const ButtonSymbols::Style* style( ButtonSymbols::style( d->internalSettings()->buttonStyle() ) );
+        if( !style || !symbols() ) return;
 
         painter->setRenderHints( QPainter::Antialiasing );
 
@@ -212,8 +399,43 @@ namespace Breeze
         painter->translate( geometry().topLeft() );
 
         const qreal width( m_iconSize.width() );
-        painter->scale( width/20, width/20 );
-        painter->translate( 1, 1 );
+        const bool shrink( ( style->flags & ButtonSymbols::ShrinkWithoutAnimations ) && !d->internalSettings()->animationsEnabled() );
+        if( shrink )
+        {
+            painter->scale( 7./9.*width/20, 7./9.*width/20 );
+            painter->translate( 4, 4 );
+        } else {
+            painter->scale( width/20, width/20 );
+            painter->translate( 1, 1 );
+        }
+
+        // shrunk buttons keep their pen widths
+        const qreal penScale( ( shrink ? 9./7. : 1.0 )*qMax( (qreal)1.0, 20/width ) );
+
+        switch( style->background )
+        {
+            case ButtonSymbols::PlasmaBackground: drawPlasmaIcon( painter, *style, penScale ); break;
+            case ButtonSymbols::GnomeBackground: drawGnomeIcon( painter, *style, penScale ); break;
+            default: drawCircleIcon( painter, *style, penScale ); break;
+        }
+
+    }
+
+    //__________________________________________________________________
+    const ButtonSymbols* Button::symbols() const
+    {
+        // settings may have been reloaded after this button was reconfigured
+        auto d = qobject_cast<Decoration*>( decoration() );
+        if( !d ) return m_symbols;
+
+        const int style( d->internalSettings()->buttonStyle() );
+        if( m_symbols && m_symbols->family() == ButtonSymbols::family( style ) ) return m_symbols;
+        else return ButtonSymbols::forStyle( style );
+    }
+
+    //__________________________________________________________________
+    void Button::drawPlasmaIcon( QPainter *painter, const ButtonSymbols::Style& style, qreal penScale ) const
+    {
 
         // render background
         QColor backgroundColor( this->backgroundColor() );
@@ -233,191 +455,24 @@ namespace Breeze
             QPen pen( foregroundColor );
             pen.setCapStyle( Qt::RoundCap );
             pen.setJoinStyle( Qt::MiterJoin );
-            pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-            painter->setPen( pen );
-            painter->setBrush( Qt::NoBrush );
-
-            switch( type() )
-            {
-
-                case DecorationButtonType::Close:
-                {
-                    painter->drawLine( QPointF( 5, 5 ), QPointF( 13, 13 ) );
-                    painter->drawLine( 13, 5, 5, 13 );
-                    break;
-                }
-
-                case DecorationButtonType::Maximize:
-                {
-                    if( isChecked() )
-                    {
-                        pen.setJoinStyle( Qt::RoundJoin );
-                        painter->setPen( pen );
-
-                        painter->drawPolygon( QVector<QPointF>{
-                            QPointF( 4, 9 ),
-                            QPointF( 9, 4 ),
-                            QPointF( 14, 9 ),
-                            QPointF( 9, 14 )} );
-
-                    } else {
-                        painter->drawPolyline( QVector<QPointF>{
-                            QPointF( 4, 11 ),
-                            QPointF( 9, 6 ),
-                            QPointF( 14, 11 )});
-                    }
-                    break;
-                }
-
-                case DecorationButtonType::Minimize:
-                {
-                    painter->drawPolyline( QVector<QPointF>{
-                        QPointF( 4, 7 ),
-                        QPointF( 9, 12 ),
-                        QPointF( 14, 7 ) });
-                    break;
-                }
-
-                case DecorationButtonType::OnAllDesktops:
-                {
-                    painter->setPen( Qt::NoPen );
-                    painter->setBrush( foregroundColor );
-
-                    if( isChecked())
-                    {
-
-                        // outer ring
-                        painter->drawEllipse( QRectF( 3, 3, 12, 12 ) );
-
-                        // center dot
-                        QColor backgroundColor( this->backgroundColor() );
-                        auto d = qobject_cast<Decoration*>( decoration() );
-                        if( !backgroundColor.isValid() && d ) backgroundColor = d->titleBarColor();
-
-                        if( backgroundColor.isValid() )
-                        {
-                            painter->setBrush( backgroundColor );
-                            painter->drawEllipse( QRectF( 8, 8, 2, 2 ) );
-                        }
-
-                    } else {
-
-                        painter->drawPolygon( QVector<QPointF> {
-                            QPointF( 6.5, 8.5 ),
-                            QPointF( 12, 3 ),
-                            QPointF( 15, 6 ),
-                            QPointF( 9.5, 11.5 )} );
-
-                        painter->setPen( pen );
-                        painter->drawLine( QPointF( 5.5, 7.5 ), QPointF( 10.5, 12.5 ) );
-                        painter->drawLine( QPointF( 12, 6 ), QPointF( 4.5, 13.5 ) );
-                    }
-                    break;
-                }
-
-                case DecorationButtonType::Shade:
-                {
-
-                    if (isChecked())
-                    {
-
-                        painter->drawLine( QPointF( 4, 5.5 ), QPointF( 14, 5.5 ) ); // painter->drawLine( 4, 5, 14, 5 );
-                        painter->drawPolyline( QVector<QPointF> {
-                            QPointF( 4, 8 ),
-                            QPointF( 9, 13 ),
-                            QPointF( 14, 8 )} );
-
-                    } else {
-
-                        painter->drawLine( QPointF( 4, 5.5 ), QPointF( 14, 5.5 ) ); // painter->drawLine( 4, 5, 14, 5 );
-                        painter->drawPolyline(  QVector<QPointF> {
-                            QPointF( 4, 13 ),
-                            QPointF( 9, 8 ),
-                            QPointF( 14, 13 ) });
-                    }
-
-                    break;
-
-                }
-
-                case DecorationButtonType::KeepBelow:
-                {
-
-                    painter->drawPolyline(  QVector<QPointF> {
-                        QPointF( 4, 5 ),
-                        QPointF( 9, 10 ),
-                        QPointF( 14, 5 ) });
-
-                    painter->drawPolyline(  QVector<QPointF> {
-                        QPointF( 4, 9 ),
-                        QPointF( 9, 14 ),
-                        QPointF( 14, 9 ) });
-                    break;
+            pen.setWidthF( style.penWidth*penScale );
 
-                }
-
-                case DecorationButtonType::KeepAbove:
-                {
-                    painter->drawPolyline(  QVector<QPointF> {
-                        QPointF( 4, 9 ),
-                        QPointF( 9, 4 ),
-                        QPointF( 14, 9 ) });
-
-                    painter->drawPolyline(  QVector<QPointF> {
-                        QPointF( 4, 13 ),
-                        QPointF( 9, 8 ),
-                        QPointF( 14, 13 ) });
-                    break;
-                }
-
-
-                case DecorationButtonType::ApplicationMenu:
-                {
-                    painter->drawRect( QRectF( 3.5, 4.5, 11, 1 ) ); // painter->drawLine( QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) );
-                    painter->drawRect( QRectF( 3.5, 8.5, 11, 1 ) ); // painter->drawLine( QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) );
-                    painter->drawRect( QRectF( 3.5, 12.5, 11, 1 ) ); // painter->drawLine( QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) );
-                    break;
-                }
-
-                case DecorationButtonType::ContextHelp:
-                {
-                    QPainterPath path;
-                    path.moveTo( 5, 6 );
-                    path.arcTo( QRectF( 5, 3.5, 8, 5 ), 180, -180 );
-                    path.cubicTo( QPointF(12.5, 9.5), QPointF( 9, 7.5 ), QPointF( 9, 11.5 ) );
-                    painter->drawPath( path );
-
-                    painter->drawRect( QRectF( 9, 15, 0.5, 0.5 ) ); // painter->drawPoint( 9, 15 );
-
-                    break;
-                }
+            // the center dot of the on all desktops symbol falls back to the title bar color
+            auto d = qobject_cast<Decoration*>( decoration() );
+            if( !backgroundColor.isValid() && d ) backgroundColor = d->titleBarColor();
 
-                default: break;
-            }
+            symbols()->paint( painter, type(), isChecked(), pen, foregroundColor, backgroundColor );
 
         }
 
     }
 
     //__________________________________________________________________
-    void Button::drawIconGnome( QPainter *painter ) const
+    void Button::drawGnomeIcon( QPainter *painter, const ButtonSymbols::Style& style, qreal penScale ) const
     {
 
-        painter->setRenderHints( QPainter::Antialiasing );
-
-        /*
-        scale painter so that its window matches QRect( -1, -1, 20, 20 )
-        this makes all further rendering and scaling simpler
-        all further rendering is preformed inside QRect( 0, 0, 18, 18 )
-        */
-        painter->translate( geometry().topLeft() );
-
-        const qreal width( m_iconSize.width() );
-        painter->scale( width/20, width/20 );
-        painter->translate( 1, 1 );
-
         auto d = qobject_cast<Decoration*>( decoration() );
+        const qreal width( m_iconSize.width() );
 
         // render background
         QColor backgroundColor;
@@ -483,3429 +538,219 @@ namespace Breeze
             // setup painter
             QPen pen( foregroundColor );
             pen.setJoinStyle( Qt::MiterJoin );
-            pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
+            pen.setWidthF( style.penWidth*penScale );
 
-            switch( type() )
-            {
+            symbols()->paint( painter, type(), isChecked(), pen, foregroundColor, QColor() );
 
-                case DecorationButtonType::Close:
-                {
-                    painter->setPen( pen );
-                    painter->setBrush( Qt::NoBrush );
+        }
 
-                    painter->drawLine( QPointF( 6.5, 6.5 ), QPointF( 11.5, 11.5 ) );
-                    painter->drawLine( QPointF( 11.5, 6.5 ), QPointF( 6.5, 11.5 ) );
-                    break;
-                }
+    }
 
-                case DecorationButtonType::Maximize:
-                {
-                    painter->setPen( pen );
-                    painter->setBrush( Qt::NoBrush );
+    //__________________________________________________________________
+    void Button::drawCircleIcon( QPainter *painter, const ButtonSymbols::Style& style, qreal penScale ) const
+    {
 
-                    if( isChecked() )
-                        painter->drawRect(QRectF(7.5, 7.5, 3, 3));
-                    else
-                        painter->drawRect(QRectF(6.5, 6.5, 5, 5));
-                    break;
-                }
+        auto d = qobject_cast<Decoration*>( decoration() );
+        const bool inactiveWindow( !d->client().toStrongRef().data()->isActive() );
+        const bool isSystemForegroundColor( d->internalSettings()->systemForegroundColor() );
+        const bool monochrome( style.background == ButtonSymbols::Monochrome );
 
-                case DecorationButtonType::Minimize:
-                {
-                    painter->setPen( pen );
-                    painter->setBrush( Qt::NoBrush );
+        const QColor titleBarColor( d->titleBarColor() );
+        const bool darkTitleBar( qGray( titleBarColor.rgb() ) < 128 );
 
-                    painter->drawLine( QPointF( 6.5, 11.5 ), QPointF( 11.5, 11.5 ) );
-                    break;
-                }
+        // symbol colors for light and dark title bars. Inactive windows use softer ones, when matching the title bar color
+        const bool softSymbolColors( !monochrome && inactiveWindow && d->internalSettings()->matchColorForTitleBar() );
+        const QColor darkSymbolColor( softSymbolColors ? QColor(81, 102, 107) : QColor(34, 45, 50) );
+        const QColor lightSymbolColor( softSymbolColors ? QColor(192, 193, 194) : QColor(250, 251, 252) );
 
-                case DecorationButtonType::OnAllDesktops:
-                {
+        // title bar contrast color, from its luminance
+        const QColor contrastColor( this->autoColor( true, false, false, darkSymbolColor, lightSymbolColor ) );
 
-                    painter->setPen( Qt::NoPen );
-                    painter->setBrush( foregroundColor );
-
-                    QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                    if( isChecked()) {
-                        painter->drawEllipse( c, 1.0, 1.0 );
-                    }
-                    else {
-                        painter->drawEllipse( c, 2.0, 2.0 );
-                    }
-                    break;
-                }
+        // symbols color, and the color monochrome symbols are mixed with
+        QColor symbolColor;
+        QColor symbolBgdColor;
+        if( monochrome )
+        {
 
-                case DecorationButtonType::Shade:
-                {
+            if( isSystemForegroundColor )
+            {
+                symbolColor = this->foregroundColor();
+                symbolBgdColor = this->backgroundColor();
+            } else {
+                symbolColor = contrastColor;
+                symbolBgdColor = ( contrastColor == darkSymbolColor ) ? lightSymbolColor : darkSymbolColor;
+            }
 
-                    painter->setPen( pen );
+        } else if( isSystemForegroundColor ) {
 
-                    if (isChecked())
-                    {
+            symbolColor = this->fontColor();
 
-                        painter->drawLine( 6, 12.5, 12, 12.5 );
+        } else if( style.background == ButtonSymbols::Outline ) {
 
-                        QPainterPath path;
-                        path.moveTo(9, 12.5);
-                        path.lineTo(5, 6.5);
-                        path.lineTo(13, 6.5);
-                        painter->fillPath(path, QBrush(foregroundColor));
+            symbolColor = this->autoColor( inactiveWindow, style.inactiveLook == ButtonSymbols::AlwaysActive, style.inactiveLook == ButtonSymbols::AlwaysInactive, darkSymbolColor, lightSymbolColor );
 
+        } else {
 
-                    } else {
+            symbolColor = ( inactiveWindow && darkTitleBar ) ? lightSymbolColor : darkSymbolColor;
 
-                        painter->drawLine( 6, 7.5, 12, 7.5 );
+        }
 
-                        QPainterPath path;
-                        path.moveTo(9, 7.5);
-                        path.lineTo(5, 12.5);
-                        path.lineTo(13, 12.5);
-                        painter->fillPath(path, QBrush(foregroundColor));
+        // symbols pen
+        QPen symbol_pen( symbolColor );
+        symbol_pen.setJoinStyle( Qt::MiterJoin );
+        symbol_pen.setWidthF( style.penWidth*penScale );
 
-                    }
+        // application menu has no background
+        if( type() == DecorationButtonType::ApplicationMenu )
+        {
 
-                    break;
+            if( monochrome )
+            {
+                symbols()->paint( painter, type(), isChecked(), symbol_pen, symbolColor );
+                return;
+            }
 
-                }
+            const QColor menuSymbolColor( isSystemForegroundColor ? this->fontColor() : contrastColor );
+            QPen menuSymbol_pen( menuSymbolColor );
+            menuSymbol_pen.setJoinStyle( Qt::MiterJoin );
+            menuSymbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/qreal( m_iconSize.width() ) ) );
 
-                case DecorationButtonType::KeepBelow:
-                {
+            symbols()->paint( painter, type(), isChecked(), menuSymbol_pen, menuSymbolColor );
+            return;
 
-                    painter->setPen( Qt::NoPen );
+        }
 
-                    QPainterPath path;
-                    path.moveTo(9, 11.5);
-                    path.lineTo(5, 6.5);
-                    path.lineTo(13, 6.5);
-                    painter->fillPath(path, QBrush(foregroundColor));
+        const ButtonSymbols::TypeStyle& typeStyle( ButtonSymbols::typeStyle( type() ) );
+        const bool shownWhenChecked( isChecked() && ( typeStyle.flags & ButtonSymbols::ShownWhenChecked ) );
+        const bool keepsColor( isChecked() && ( typeStyle.flags & ButtonSymbols::KeepsColorWhenChecked ) );
+        const QPointF center( 9, 9 );
 
-                    break;
+        QColor button_color;
+        bool visible( true );
+        switch( style.background )
+        {
 
-                }
+            case ButtonSymbols::TrafficLight:
+            case ButtonSymbols::Outline:
+            {
 
-                case DecorationButtonType::KeepAbove:
-                {
+                if( style.background == ButtonSymbols::TrafficLight && inactiveWindow ) button_color = darkTitleBar ? QColor(100, 100, 100) : QColor(200, 200, 200);
+                else button_color = QColor( darkTitleBar ? typeStyle.darkTitleBarColor : typeStyle.lightTitleBarColor );
 
-                    painter->setPen( Qt::NoPen );
+                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
+                button_pen.setJoinStyle( Qt::MiterJoin );
+                button_pen.setWidthF( PenWidth::Symbol*penScale );
 
-                    QPainterPath path;
-                    path.moveTo(9, 6.5);
-                    path.lineTo(5, 11.5);
-                    path.lineTo(13, 11.5);
-                    painter->fillPath(path, QBrush(foregroundColor));
+                // outlined styles show a ring, or nothing, with the inactive look
+                const bool inactiveLook( style.background == ButtonSymbols::Outline &&
+                    ( ( inactiveWindow && style.inactiveLook != ButtonSymbols::AlwaysActive ) || style.inactiveLook == ButtonSymbols::AlwaysInactive ) );
+                visible = this->hovered() || shownWhenChecked || inactiveLook;
 
-                    break;
+                if( inactiveLook && ( this->hovered() || shownWhenChecked ) )
+                {
+                    painter->setBrush( Qt::NoBrush );
+                    painter->setPen( button_pen );
+                } else if( inactiveLook ) {
+                    painter->setBrush( Qt::NoBrush );
+                    painter->setPen( Qt::NoPen );
+                } else {
+                    painter->setBrush( button_color );
+                    painter->setPen( button_pen );
                 }
 
+                const qreal r( this->buttonRadius() );
+                painter->drawEllipse( center, r, r );
 
-                case DecorationButtonType::ApplicationMenu:
-                {
-                    painter->setPen( pen );
-                    painter->setBrush( Qt::NoBrush );
+                // symbols are painted in the symbol color
+                button_color = symbolColor;
+                break;
 
-                    painter->drawLine( QPointF( 6.5, 6.5 ), QPointF( 11.5, 6.5 ) );
-                    painter->drawLine( QPointF( 6.5, 9 ), QPointF( 11.5, 9 ) );
-                    painter->drawLine( QPointF( 6.5, 11.5 ), QPointF( 11.5, 11.5 ) );
-                    break;
-                }
+            }
 
-                case DecorationButtonType::ContextHelp:
-                {
-                    painter->setPen( pen );
+            case ButtonSymbols::Tinted:
+            {
 
-                    int startAngle = 260 * 16;
-                    int spanAngle = 280 * 16;
-                    painter->drawArc( QRectF( 7, 5.5, 4, 4), startAngle, spanAngle );
+                button_color = QColor( typeStyle.darkTitleBarColor );
+                if( !keepsColor ) button_color.setAlpha( button_color.alpha()*m_opacity );
+                painter->setPen( Qt::NoPen );
+                painter->setBrush( button_color );
 
-                    painter->setBrush( foregroundColor );
+                const qreal r( this->buttonRadius() );
+                painter->drawEllipse( center, r, r );
 
-                    QPointF c = QPointF (static_cast<qreal>(9), static_cast<qreal>(12));
-                    painter->drawEllipse( c, 0.5, 0.5 );
+                button_color.setAlpha( 255 );
+                button_color = keepsColor ? symbolColor : this->mixColors( button_color.darker( 100 ), symbolColor, m_opacity );
+                break;
 
-                    break;
-                }
+            }
+
+            case ButtonSymbols::Monochrome:
+            default:
+            {
+
+                button_color = symbolColor;
+                if( !keepsColor ) button_color.setAlpha( button_color.alpha()*m_opacity );
+                painter->setPen( Qt::NoPen );
+                painter->setBrush( button_color );
+
+                qreal r;
+                if( !( style.flags & ButtonSymbols::HoverRadius ) ) r = this->buttonRadius();
+                else if( shownWhenChecked ) r = 9;
+                else r = static_cast<qreal>(7) + static_cast<qreal>(2) * m_opacity;
+                painter->drawEllipse( center, r, r );
+
+                // checked toggles invert the symbol once no longer hovered
+                button_color.setAlpha( 255 );
+                symbolBgdColor.setAlpha( 255 );
+                if( keepsColor && !this->hovered() ) button_color = this->mixColors( symbolBgdColor, button_color, m_opacity );
+                else button_color = this->mixColors( button_color, symbolBgdColor, m_opacity );
+                break;
 
-                default: break;
             }
 
         }
 
-    }
+        painter->setBrush( Qt::NoBrush );
+        if( !visible ) return;
 
-    //__________________________________________________________________
-    void Button::drawIconMacSierra( QPainter *painter ) const
-    {
+        // symbol, with details in the unmixed symbol color
+        symbol_pen.setColor( button_color );
+        const bool thinPen( ( style.flags & ButtonSymbols::ThinUncheckedShade ) && type() == DecorationButtonType::Shade && !isChecked() );
+        const bool alternate( ( style.flags & ButtonSymbols::AlternateWhileAnimating ) && !isChecked() && !isHovered() && d->internalSettings()->animationsEnabled() );
+        symbols()->paint( painter, type(), isChecked(), thinPen ? QPen( button_color ) : symbol_pen, button_color, QColor(), symbolColor, alternate );
 
-        painter->setRenderHints( QPainter::Antialiasing );
+    }
 
-        /*
-        scale painter so that its window matches QRect( -1, -1, 20, 20 )
-        this makes all further rendering and scaling simpler
-        all further rendering is preformed inside QRect( 0, 0, 18, 18 )
-        */
-        painter->translate( geometry().topLeft() );
+    //__________________________________________________________________
+    // https://stackoverflow.com/questions/25514812/how-to-animate-color-of-qbrush
+    QColor Button::mixColors(const QColor &cstart, const QColor &cend, qreal progress) const
+    { return ColorRamp::hsv( cstart, cend, progress ); }
 
-        const qreal width( m_iconSize.width() );
+    //__________________________________________________________________
+    QColor Button::fontColor() const
+    {
         auto d = qobject_cast<Decoration*>( decoration() );
-        if ( d->internalSettings()->animationsEnabled() ) {
-          painter->scale( width/20, width/20 );
-          painter->translate( 1, 1 );
-        }
-        else {
-          painter->scale( 7./9.*width/20, 7./9.*width/20 );
-          painter->translate( 4, 4 );
-        }
+        QColor titleBarColor ( d->titleBarColor() );
 
-        bool inactiveWindow( d && !d->client().toStrongRef().data()->isActive() );
-        bool isMatchTitleBarColor( d && d->internalSettings()->matchColorForTitleBar() );
+        if( !d ) {
 
-        QColor darkSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(81, 102, 107) : QColor(34, 45, 50) );
-        QColor lightSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(192, 193, 194) : QColor(250, 251, 252) );
+            return QColor();
 
-        QColor titleBarColor (d->titleBarColor());
+        } else {
 
-        // symbols color
+            return d->fontColor();
 
-        QColor symbolColor;
-        bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-        if (isSystemForegroundColor)
-          symbolColor = this->fontColor();
-        else {
-          if ( inactiveWindow && qGray(titleBarColor.rgb()) < 128 )
-            symbolColor = lightSymbolColor;
-          else if ( inactiveWindow && qGray(titleBarColor.rgb()) > 128 )
-            symbolColor = darkSymbolColor;
-          else
-            symbolColor = this->autoColor( false, true, false, darkSymbolColor, lightSymbolColor );
         }
 
-        // symbols pen
+    }
 
-        QPen symbol_pen( symbolColor );
-        symbol_pen.setJoinStyle( Qt::MiterJoin );
-        if ( d->internalSettings()->animationsEnabled() )
-          symbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/width ) );
-        else
-          symbol_pen.setWidthF( 9./7.*1.7*qMax((qreal)1.0, 20/width ) );
+    //__________________________________________________________________
+    QColor Button::foregroundColor() const
+    {
+        auto d = qobject_cast<Decoration*>( decoration() );
+        QColor titleBarColor ( d->titleBarColor() );
 
-        switch( type() )
-        {
-
-            case DecorationButtonType::Close:
-            {
-                QColor button_color;
-                if ( !inactiveWindow && qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(238, 102, 90);
-                else if( !inactiveWindow )
-                  button_color = QColor(255, 94, 88);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-                if ( this->hovered() )
-                {
-                  painter->setPen( symbol_pen );
-                  // it's a cross
-                  painter->drawLine( QPointF( 6, 6 ), QPointF( 12, 12 ) );
-                  painter->drawLine( QPointF( 6, 12 ), QPointF( 12, 6 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::Maximize:
-            {
-                QColor button_color;
-                if ( !inactiveWindow && qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 196, 86);
-                else if( !inactiveWindow )
-                  button_color = QColor(40, 200, 64);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-                if ( this->hovered() )
-                {
-                  painter->setPen( Qt::NoPen );
-
-                  // two triangles
-                  QPainterPath path1, path2;
-                  if( isChecked() )
-                  {
-                      path1.moveTo(8.5, 9.5);
-                      path1.lineTo(2.5, 9.5);
-                      path1.lineTo(8.5, 15.5);
-
-                      path2.moveTo(9.5, 8.5);
-                      path2.lineTo(15.5, 8.5);
-                      path2.lineTo(9.5, 2.5);
-                  }
-                  else
-                  {
-                      path1.moveTo(5, 13);
-                      path1.lineTo(11, 13);
-                      path1.lineTo(5, 7);
-
-                      path2.moveTo(13, 5);
-                      path2.lineTo(7, 5);
-                      path2.lineTo(13, 11);
-                  }
-
-                  painter->fillPath(path1, QBrush(symbolColor));
-                  painter->fillPath(path2, QBrush(symbolColor));
-                }
-                break;
-            }
-
-            case DecorationButtonType::Minimize:
-            {
-                QColor button_color;
-                if ( !inactiveWindow && qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(223, 192, 76);
-                else if( !inactiveWindow )
-                  button_color = QColor(255, 188, 48);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-                if ( this->hovered() )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawLine( QPointF( 5, 9 ), QPointF( 13, 9 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::OnAllDesktops:
-            {
-                QColor button_color;
-                if ( !inactiveWindow )
-                  button_color = QColor(125, 209, 200);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() )
-                {
-                  painter->setPen( Qt::NoPen );
-                  painter->setBrush(QBrush(symbolColor));
-                  painter->drawEllipse( QRectF( 6, 6, 6, 6 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::Shade:
-            {
-                QColor button_color;
-                if ( !inactiveWindow )
-                  button_color = QColor(204, 176, 213);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( isChecked() )
-                {
-                    painter->setPen( symbol_pen );
-                    painter->drawLine( QPointF( 6, 12 ), QPointF( 12, 12 ) );
-                    painter->setPen( Qt::NoPen );
-                    QPainterPath path;
-                    path.moveTo(9, 11);
-                    path.lineTo(5, 6);
-                    path.lineTo(13, 6);
-                    painter->fillPath(path, QBrush(symbolColor));
-
-                }
-                else if ( this->hovered() ) {
-                    painter->setPen( symbol_pen );
-                    painter->drawLine( QPointF( 6, 6 ), QPointF( 12, 6 ) );
-                    painter->setPen( Qt::NoPen );
-                    QPainterPath path;
-                    path.moveTo(9, 7);
-                    path.lineTo(5, 12);
-                    path.lineTo(13, 12);
-                    painter->fillPath(path, QBrush(symbolColor));
-                }
-                break;
-
-            }
-
-            case DecorationButtonType::KeepBelow:
-            {
-                QColor button_color;
-                if ( !inactiveWindow )
-                  button_color = QColor(255, 137, 241);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() )
-                {
-                  painter->setPen( Qt::NoPen );
-
-                  QPainterPath path;
-                  path.moveTo(9, 12);
-                  path.lineTo(5, 6);
-                  path.lineTo(13, 6);
-                  painter->fillPath(path, QBrush(symbolColor));
-                }
-                break;
-
-            }
-
-            case DecorationButtonType::KeepAbove:
-            {
-                QColor button_color;
-                if ( !inactiveWindow )
-                  button_color = QColor(135, 206, 249);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() )
-                {
-                  painter->setPen( Qt::NoPen );
-
-                  QPainterPath path;
-                  path.moveTo(9, 6);
-                  path.lineTo(5, 12);
-                  path.lineTo(13, 12);
-                  painter->fillPath(path, QBrush(symbolColor));
-                }
-                break;
-            }
-
-            case DecorationButtonType::ApplicationMenu:
-            {
-                QColor menuSymbolColor;
-                bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-                if (isSystemForegroundColor)
-                  menuSymbolColor = this->fontColor();
-                else {
-                  uint r = qRed(titleBarColor.rgb());
-                  uint g = qGreen(titleBarColor.rgb());
-                  uint b = qBlue(titleBarColor.rgb());
-                  // modified from https://stackoverflow.com/questions/3942878/how-to-decide-font-color-in-white-or-black-depending-on-background-color
-                  // qreal titleBarLuminance = (0.2126 * static_cast<qreal>(r) + 0.7152 * static_cast<qreal>(g) + 0.0722 * static_cast<qreal>(b)) / 255.;
-                  // if ( titleBarLuminance >  sqrt(1.05 * 0.05) - 0.05 )
-                  qreal colorConditional = 0.299 * static_cast<qreal>(r) + 0.587 * static_cast<qreal>(g) + 0.114 * static_cast<qreal>(b);
-                  if ( colorConditional > 186 || g > 186 )
-                    menuSymbolColor = darkSymbolColor;
-                  else
-                    menuSymbolColor = lightSymbolColor;
-                }
-
-                QPen menuSymbol_pen( menuSymbolColor );
-                menuSymbol_pen.setJoinStyle( Qt::MiterJoin );
-                menuSymbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/width ) );
-
-                painter->setPen( menuSymbol_pen );
-
-                painter->drawLine( QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) );
-                painter->drawLine( QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) );
-                painter->drawLine( QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::ContextHelp:
-            {
-                QColor button_color;
-                if ( !inactiveWindow )
-                  button_color = QColor(102, 156, 246);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() )
-                {
-                  painter->setPen( symbol_pen );
-                  QPainterPath path;
-                  path.moveTo( 6, 6 );
-                  path.arcTo( QRectF( 5.5, 4, 7.5, 4.5 ), 180, -180 );
-                  path.cubicTo( QPointF(11, 9), QPointF( 9, 6 ), QPointF( 9, 10 ) );
-                  painter->drawPath( path );
-                  painter->drawPoint( 9, 13 );
-                }
-                break;
-            }
-
-            default: break;
-        }
-    }
-
-    //__________________________________________________________________
-    void Button::drawIconMacDarkAurorae( QPainter *painter ) const
-    {
-
-        painter->setRenderHints( QPainter::Antialiasing );
-
-        /*
-        scale painter so that its window matches QRect( -1, -1, 20, 20 )
-        this makes all further rendering and scaling simpler
-        all further rendering is preformed inside QRect( 0, 0, 18, 18 )
-        */
-        painter->translate( geometry().topLeft() );
-
-        const qreal width( m_iconSize.width() );
-        auto d = qobject_cast<Decoration*>( decoration() );
-        if ( d->internalSettings()->animationsEnabled() ) {
-          painter->scale( width/20, width/20 );
-          painter->translate( 1, 1 );
-        }
-        else {
-          painter->scale( 7./9.*width/20, 7./9.*width/20 );
-          painter->translate( 4, 4 );
-        }
-
-        bool inactiveWindow( d && !d->client().toStrongRef().data()->isActive() );
-        bool isMatchTitleBarColor( d && d->internalSettings()->matchColorForTitleBar() );
-
-        QColor darkSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(81, 102, 107) : QColor(34, 45, 50) );
-        QColor lightSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(192, 193, 194) : QColor(250, 251, 252) );
-
-        QColor titleBarColor (d->titleBarColor());
-
-        // symbols color
-
-        QColor symbolColor;
-        bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-        if (isSystemForegroundColor)
-          symbolColor = this->fontColor();
-        else {
-          if ( inactiveWindow && qGray(titleBarColor.rgb()) < 128 )
-              symbolColor = lightSymbolColor;
-          else if ( inactiveWindow && qGray(titleBarColor.rgb()) > 128 )
-              symbolColor = darkSymbolColor;
-          else
-              symbolColor = this->autoColor( false, true, false, darkSymbolColor, lightSymbolColor );
-        }
-
-        // symbols pen
-
-        QPen symbol_pen( symbolColor );
-        symbol_pen.setJoinStyle( Qt::MiterJoin );
-        if ( d->internalSettings()->animationsEnabled() )
-          symbol_pen.setWidthF( 1.2*qMax((qreal)1.0, 20/width ) );
-        else
-          symbol_pen.setWidthF( 9./7.*1.2*qMax((qreal)1.0, 20/width ) );
-
-        switch( type() )
-        {
-
-            case DecorationButtonType::Close:
-            {
-                QColor button_color;
-                if ( !inactiveWindow && qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(238, 102, 90);
-                else if( !inactiveWindow )
-                  button_color = QColor(255, 94, 88);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-                if ( this->hovered() )
-                {
-                  painter->setPen( symbol_pen );
-                  // it's a cross
-                  painter->drawLine( QPointF( 5, 5 ), QPointF( 13, 13 ) );
-                  painter->drawLine( QPointF( 5, 13 ), QPointF( 13, 5 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::Maximize:
-            {
-                QColor button_color;
-                if ( !inactiveWindow && qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 196, 86);
-                else if( !inactiveWindow )
-                  button_color = QColor(40, 200, 64);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-                if ( this->hovered() )
-                {
-
-                  painter->setPen( symbol_pen );
-
-                  // solid vs. open rectangle
-                  if( isChecked() )
-                  {
-                      painter->drawLine( QPointF( 4.5, 6 ), QPointF( 13.5, 6 ) );
-                      painter->drawLine( QPointF( 13.5, 6 ), QPointF( 13.5, 12 ) );
-                      painter->drawLine( QPointF( 4.5, 6 ), QPointF( 4.5, 12 ) );
-                      painter->drawLine( QPointF( 4.5, 12 ), QPointF( 13.5, 12 ) );
-                  }
-                  else
-                  {
-                      painter->drawLine( QPointF( 4.5, 4.5 ), QPointF( 13.5, 4.5 ) );
-                      painter->drawLine( QPointF( 13.5, 4.5 ), QPointF( 13.5, 9 ) );
-                      painter->drawLine( QPointF( 4.5, 9 ), QPointF( 4.5, 13.5 ) );
-                      painter->drawLine( QPointF( 4.5, 13.5 ), QPointF( 13.5, 13.5 ) );
-                  }
-
-                }
-                break;
-            }
-
-            case DecorationButtonType::Minimize:
-            {
-                QColor button_color;
-                if ( !inactiveWindow && qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(223, 192, 76);
-                else if( !inactiveWindow )
-                  button_color = QColor(255, 188, 48);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawLine( QPointF( 5, 9 ), QPointF( 13, 9 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::OnAllDesktops:
-            {
-                QColor button_color;
-                if ( !inactiveWindow )
-                  button_color = QColor(125, 209, 200);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() && !isChecked() )
-                {
-                  painter->setPen( symbol_pen );
-
-                  if ( !isHovered() && d->internalSettings()->animationsEnabled() ) {
-                    painter->drawLine( QPointF( 5, 5 ), QPointF( 13, 5 ) );
-                    painter->drawLine( QPointF( 13, 5 ), QPointF( 13, 13 ) );
-                    painter->drawLine( QPointF( 5, 5 ), QPointF( 5, 13 ) );
-                    painter->drawLine( QPointF( 5, 13 ), QPointF( 13, 13 ) );
-
-                    painter->setBrush(QBrush(symbolColor));
-                    painter->drawEllipse( c, 0.5, 0.5 );
-                  }
-                  else {
-                    painter->drawLine( QPointF( 7, 5 ), QPointF( 15, 5 ) );
-                    painter->drawLine( QPointF( 15, 5 ), QPointF( 15, 13 ) );
-                    painter->drawLine( QPointF( 7, 5 ), QPointF( 7, 13 ) );
-                    painter->drawLine( QPointF( 7, 13 ), QPointF( 15, 13 ) );
-
-                    painter->drawLine( QPointF( 3, 5 ), QPointF( 3, 13 ) );
-                    painter->drawLine( QPointF( 3, 5 ), QPointF( 4.5, 5 ) );
-                    painter->drawLine( QPointF( 3, 13 ), QPointF( 4.5, 13 ) );
-                  }
-
-                }
-                else if ( isChecked() )
-                {
-                  painter->setPen( symbol_pen );
-
-                  painter->drawLine( QPointF( 5, 5 ), QPointF( 11, 5 ) );
-                  painter->drawLine( QPointF( 11, 5 ), QPointF( 11, 11 ) );
-                  painter->drawLine( QPointF( 5, 5 ), QPointF( 5, 11 ) );
-                  painter->drawLine( QPointF( 5, 11 ), QPointF( 11, 11 ) );
-
-                  painter->drawLine( QPointF( 7, 7 ), QPointF( 13, 7 ) );
-                  painter->drawLine( QPointF( 13, 7 ), QPointF( 13, 13 ) );
-                  painter->drawLine( QPointF( 7, 7 ), QPointF( 7, 13 ) );
-                  painter->drawLine( QPointF( 7, 13 ), QPointF( 13, 13 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::Shade:
-            {
-                QColor button_color;
-                if ( !inactiveWindow )
-                  button_color = QColor(204, 176, 213);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( isChecked() )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawLine( QPointF( 4, 12 ), QPointF( 14, 12 ) );
-
-                  painter->setBrush(QBrush(symbolColor));
-                  painter->drawEllipse( QRectF( 8, 6, 2, 2 ) );
-                }
-                else if ( this->hovered() )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawLine( QPointF( 4, 6 ), QPointF( 14, 6 ) );
-
-                  painter->setBrush(QBrush(symbolColor));
-                  painter->drawEllipse( QRectF( 8, 10, 2, 2 ) );
-                }
-                break;
-
-            }
-
-            case DecorationButtonType::KeepBelow:
-            {
-                QColor button_color;
-                if ( !inactiveWindow )
-                  button_color = QColor(255, 137, 241);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawPolyline( QVector<QPointF>{
-                           QPointF( 4, 7 ),
-                           QPointF( 9, 12 ),
-                           QPointF( 14, 7 ) });
-                }
-                break;
-
-            }
-
-            case DecorationButtonType::KeepAbove:
-            {
-                QColor button_color;
-                if ( !inactiveWindow )
-                  button_color = QColor(135, 206, 249);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawPolyline( QVector<QPointF>{
-                           QPointF( 4, 11 ),
-                           QPointF( 9, 6 ),
-                           QPointF( 14, 11 )});
-                }
-                break;
-            }
-
-            case DecorationButtonType::ApplicationMenu:
-            {
-                QColor menuSymbolColor;
-                bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-                if (isSystemForegroundColor)
-                  menuSymbolColor = this->fontColor();
-                else {
-                  uint r = qRed(titleBarColor.rgb());
-                  uint g = qGreen(titleBarColor.rgb());
-                  uint b = qBlue(titleBarColor.rgb());
-                  // modified from https://stackoverflow.com/questions/3942878/how-to-decide-font-color-in-white-or-black-depending-on-background-color
-                  // qreal titleBarLuminance = (0.2126 * static_cast<qreal>(r) + 0.7152 * static_cast<qreal>(g) + 0.0722 * static_cast<qreal>(b)) / 255.;
-                  // if ( titleBarLuminance >  sqrt(1.05 * 0.05) - 0.05 )
-                  qreal colorConditional = 0.299 * static_cast<qreal>(r) + 0.587 * static_cast<qreal>(g) + 0.114 * static_cast<qreal>(b);
-                  if ( colorConditional > 186 || g > 186 )
-                    menuSymbolColor = darkSymbolColor;
-                  else
-                    menuSymbolColor = lightSymbolColor;
-                }
-
-                QPen menuSymbol_pen( menuSymbolColor );
-                menuSymbol_pen.setJoinStyle( Qt::MiterJoin );
-                menuSymbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/width ) );
-
-                painter->setPen( menuSymbol_pen );
-
-                painter->drawLine( QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) );
-                painter->drawLine( QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) );
-                painter->drawLine( QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::ContextHelp:
-            {
-                QColor button_color;
-                if ( !inactiveWindow )
-                  button_color = QColor(102, 156, 246);
-                else if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 100, 100);
-                else
-                  button_color = QColor(200, 200, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                painter->setBrush( button_color );
-                painter->setPen( button_pen );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() )
-                {
-                  painter->setPen( symbol_pen );
-                  int startAngle = 260 * 16;
-                  int spanAngle = 280 * 16;
-                  painter->drawArc( QRectF( 6, 4, 6, 6), startAngle, spanAngle );
-
-                  painter->setBrush(QBrush(symbolColor));
-                  r = static_cast<qreal>(1);
-                  c = QPointF (static_cast<qreal>(9), static_cast<qreal>(13));
-                  painter->drawEllipse( c, r, r );
-                }
-                break;
-            }
-
-            default: break;
-        }
-    }
-
-    //__________________________________________________________________
-    void Button::drawIconSBEsierra( QPainter *painter ) const
-    {
-
-        painter->setRenderHints( QPainter::Antialiasing );
-
-        /*
-        scale painter so that its window matches QRect( -1, -1, 20, 20 )
-        this makes all further rendering and scaling simpler
-        all further rendering is preformed inside QRect( 0, 0, 18, 18 )
-        */
-        painter->translate( geometry().topLeft() );
-
-        const qreal width( m_iconSize.width() );
-        auto d = qobject_cast<Decoration*>( decoration() );
-        if ( d->internalSettings()->animationsEnabled() ) {
-          painter->scale( width/20, width/20 );
-          painter->translate( 1, 1 );
-        }
-        else {
-          painter->scale( 7./9.*width/20, 7./9.*width/20 );
-          painter->translate( 4, 4 );
-        }
-
-        bool inactiveWindow( d && !d->client().toStrongRef().data()->isActive() );
-        bool useActiveButtonStyle( d && d->internalSettings()->buttonStyle() == 5 );
-        bool useInactiveButtonStyle( d && d->internalSettings()->buttonStyle() == 6 );
-        bool isMatchTitleBarColor( d && d->internalSettings()->matchColorForTitleBar() );
-
-        QColor darkSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(81, 102, 107) : QColor(34, 45, 50) );
-        QColor lightSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(192, 193, 194) : QColor(250, 251, 252) );
-
-        QColor titleBarColor (d->titleBarColor());
-
-        // symbols color
-
-        QColor symbolColor;
-        bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-        if (isSystemForegroundColor)
-          symbolColor = this->fontColor();
-        else
-          symbolColor = this->autoColor( inactiveWindow, useActiveButtonStyle, useInactiveButtonStyle, darkSymbolColor, lightSymbolColor );
-
-        // symbols pen
-
-        QPen symbol_pen( symbolColor );
-        symbol_pen.setJoinStyle( Qt::MiterJoin );
-        if ( d->internalSettings()->animationsEnabled() )
-          symbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/width ) );
-        else
-          symbol_pen.setWidthF( 9./7.*1.7*qMax((qreal)1.0, 20/width ) );
-
-        switch( type() )
-        {
-
-            case DecorationButtonType::Close:
-            {
-                QColor button_color;
-                if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(238, 102, 90);
-                else
-                  button_color = QColor(255, 94, 88);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && this->hovered() )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-                if ( this->hovered() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( symbol_pen );
-                  // it's a cross
-                  painter->drawLine( QPointF( 6, 6 ), QPointF( 12, 12 ) );
-                  painter->drawLine( QPointF( 6, 12 ), QPointF( 12, 6 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::Maximize:
-            {
-                QColor button_color;
-                if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 196, 86);
-                else
-                  button_color = QColor(40, 200, 64);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && this->hovered() )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( Qt::NoPen );
-
-                  // two triangles
-                  QPainterPath path1, path2;
-                  if( isChecked() )
-                  {
-                      path1.moveTo(8.5, 9.5);
-                      path1.lineTo(2.5, 9.5);
-                      path1.lineTo(8.5, 15.5);
-
-                      path2.moveTo(9.5, 8.5);
-                      path2.lineTo(15.5, 8.5);
-                      path2.lineTo(9.5, 2.5);
-                  }
-                  else
-                  {
-                      path1.moveTo(5, 13);
-                      path1.lineTo(11, 13);
-                      path1.lineTo(5, 7);
-
-                      path2.moveTo(13, 5);
-                      path2.lineTo(7, 5);
-                      path2.lineTo(13, 11);
-                  }
-
-                  painter->fillPath(path1, QBrush(symbolColor));
-                  painter->fillPath(path2, QBrush(symbolColor));
-                }
-                break;
-            }
-
-            case DecorationButtonType::Minimize:
-            {
-                QColor button_color;
-                if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(223, 192, 76);
-                else
-                  button_color = QColor(255, 188, 48);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && this->hovered() )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-                if ( this->hovered() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawLine( QPointF( 5, 9 ), QPointF( 13, 9 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::OnAllDesktops:
-            {
-                QColor button_color = QColor(125, 209, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && ( this->hovered() || isChecked() ) )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() ||  ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( Qt::NoPen );
-                  painter->setBrush(QBrush(symbolColor));
-                  painter->drawEllipse( QRectF( 6, 6, 6, 6 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::Shade:
-            {
-                QColor button_color = QColor(204, 176, 213);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && ( this->hovered() || isChecked() ) )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if (isChecked())
-                {
-                    painter->setPen( symbol_pen );
-                    painter->drawLine( QPointF( 6, 12 ), QPointF( 12, 12 ) );
-                    painter->setPen( Qt::NoPen );
-                    QPainterPath path;
-                    path.moveTo(9, 11);
-                    path.lineTo(5, 6);
-                    path.lineTo(13, 6);
-                    painter->fillPath(path, QBrush(symbolColor));
-
-                }
-                else if ( this->hovered() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) {
-                    painter->setPen( symbol_pen );
-                    painter->drawLine( QPointF( 6, 6 ), QPointF( 12, 6 ) );
-                    painter->setPen( Qt::NoPen );
-                    QPainterPath path;
-                    path.moveTo(9, 7);
-                    path.lineTo(5, 12);
-                    path.lineTo(13, 12);
-                    painter->fillPath(path, QBrush(symbolColor));
-                }
-                break;
-
-            }
-
-            case DecorationButtonType::KeepBelow:
-            {
-                QColor button_color = QColor(255, 137, 241);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && ( this->hovered() || isChecked() ) )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() ||  ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( Qt::NoPen );
-
-                  QPainterPath path;
-                  path.moveTo(9, 12);
-                  path.lineTo(5, 6);
-                  path.lineTo(13, 6);
-                  painter->fillPath(path, QBrush(symbolColor));
-                }
-                break;
-
-            }
-
-            case DecorationButtonType::KeepAbove:
-            {
-                QColor button_color = QColor(135, 206, 249);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && ( this->hovered() || isChecked() ) )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() ||  ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( Qt::NoPen );
-
-                  QPainterPath path;
-                  path.moveTo(9, 6);
-                  path.lineTo(5, 12);
-                  path.lineTo(13, 12);
-                  painter->fillPath(path, QBrush(symbolColor));
-                }
-                break;
-            }
-
-            case DecorationButtonType::ApplicationMenu:
-            {
-                QColor menuSymbolColor;
-                bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-                if (isSystemForegroundColor)
-                  menuSymbolColor = this->fontColor();
-                else {
-                  uint r = qRed(titleBarColor.rgb());
-                  uint g = qGreen(titleBarColor.rgb());
-                  uint b = qBlue(titleBarColor.rgb());
-                  // modified from https://stackoverflow.com/questions/3942878/how-to-decide-font-color-in-white-or-black-depending-on-background-color
-                  // qreal titleBarLuminance = (0.2126 * static_cast<qreal>(r) + 0.7152 * static_cast<qreal>(g) + 0.0722 * static_cast<qreal>(b)) / 255.;
-                  // if ( titleBarLuminance >  sqrt(1.05 * 0.05) - 0.05 )
-                  qreal colorConditional = 0.299 * static_cast<qreal>(r) + 0.587 * static_cast<qreal>(g) + 0.114 * static_cast<qreal>(b);
-                  if ( colorConditional > 186 || g > 186 )
-                    menuSymbolColor = darkSymbolColor;
-                  else
-                    menuSymbolColor = lightSymbolColor;
-                }
-
-                QPen menuSymbol_pen( menuSymbolColor );
-                menuSymbol_pen.setJoinStyle( Qt::MiterJoin );
-                menuSymbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/width ) );
-
-                painter->setPen( menuSymbol_pen );
-
-                painter->drawLine( QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) );
-                painter->drawLine( QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) );
-                painter->drawLine( QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::ContextHelp:
-            {
-                QColor button_color = QColor(102, 156, 246);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && ( this->hovered() || isChecked() ) )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( symbol_pen );
-                  QPainterPath path;
-                  path.moveTo( 6, 6 );
-                  path.arcTo( QRectF( 5.5, 4, 7.5, 4.5 ), 180, -180 );
-                  path.cubicTo( QPointF(11, 9), QPointF( 9, 6 ), QPointF( 9, 10 ) );
-                  painter->drawPath( path );
-                  painter->drawPoint( 9, 13 );
-                }
-                break;
-            }
-
-            default: break;
-        }
-    }
-
-    //__________________________________________________________________
-    void Button::drawIconSBEdarkAurorae( QPainter *painter ) const
-    {
-
-        painter->setRenderHints( QPainter::Antialiasing );
-
-        /*
-        scale painter so that its window matches QRect( -1, -1, 20, 20 )
-        this makes all further rendering and scaling simpler
-        all further rendering is preformed inside QRect( 0, 0, 18, 18 )
-        */
-        painter->translate( geometry().topLeft() );
-
-        const qreal width( m_iconSize.width() );
-        auto d = qobject_cast<Decoration*>( decoration() );
-        if ( d->internalSettings()->animationsEnabled() ) {
-          painter->scale( width/20, width/20 );
-          painter->translate( 1, 1 );
-        }
-        else {
-          painter->scale( 7./9.*width/20, 7./9.*width/20 );
-          painter->translate( 4, 4 );
-        }
-
-        bool inactiveWindow( d && !d->client().toStrongRef().data()->isActive() );
-        bool useActiveButtonStyle( d && d->internalSettings()->buttonStyle() == 8 );
-        bool useInactiveButtonStyle( d && d->internalSettings()->buttonStyle() == 9 );
-        bool isMatchTitleBarColor( d && d->internalSettings()->matchColorForTitleBar() );
-
-        QColor darkSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(81, 102, 107) : QColor(34, 45, 50) );
-        QColor lightSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(192, 193, 194) : QColor(250, 251, 252) );
-
-        QColor titleBarColor (d->titleBarColor());
-
-        // symbols color
-
-        QColor symbolColor;
-        bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-        if (isSystemForegroundColor)
-          symbolColor = this->fontColor();
-        else
-          symbolColor = this->autoColor( inactiveWindow, useActiveButtonStyle, useInactiveButtonStyle, darkSymbolColor, lightSymbolColor );
-
-        // symbols pen
-
-        QPen symbol_pen( symbolColor );
-        symbol_pen.setJoinStyle( Qt::MiterJoin );
-        if ( d->internalSettings()->animationsEnabled() )
-          symbol_pen.setWidthF( 1.2*qMax((qreal)1.0, 20/width ) );
-        else
-          symbol_pen.setWidthF( 9./7.*1.2*qMax((qreal)1.0, 20/width ) );
-
-        switch( type() )
-        {
-
-            case DecorationButtonType::Close:
-            {
-                QColor button_color;
-                if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(238, 102, 90);
-                else
-                  button_color = QColor(255, 94, 88);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && this->hovered() )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-                if ( this->hovered() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( symbol_pen );
-                  // it's a cross
-                  painter->drawLine( QPointF( 5, 5 ), QPointF( 13, 13 ) );
-                  painter->drawLine( QPointF( 5, 13 ), QPointF( 13, 5 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::Maximize:
-            {
-                QColor button_color;
-                if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(100, 196, 86);
-                else
-                  button_color = QColor(40, 200, 64);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && this->hovered() )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-                if ( this->hovered() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-
-                  painter->setPen( symbol_pen );
-
-                  // solid vs. open rectangle
-                  if( isChecked() )
-                  {
-                      painter->drawLine( QPointF( 4.5, 6 ), QPointF( 13.5, 6 ) );
-                      painter->drawLine( QPointF( 13.5, 6 ), QPointF( 13.5, 12 ) );
-                      painter->drawLine( QPointF( 4.5, 6 ), QPointF( 4.5, 12 ) );
-                      painter->drawLine( QPointF( 4.5, 12 ), QPointF( 13.5, 12 ) );
-                  }
-                  else
-                  {
-                      painter->drawLine( QPointF( 4.5, 4.5 ), QPointF( 13.5, 4.5 ) );
-                      painter->drawLine( QPointF( 13.5, 4.5 ), QPointF( 13.5, 9 ) );
-                      painter->drawLine( QPointF( 4.5, 9 ), QPointF( 4.5, 13.5 ) );
-                      painter->drawLine( QPointF( 4.5, 13.5 ), QPointF( 13.5, 13.5 ) );
-                  }
-
-                }
-                break;
-            }
-
-            case DecorationButtonType::Minimize:
-            {
-                QColor button_color;
-                if ( qGray(titleBarColor.rgb()) < 128 )
-                  button_color = QColor(223, 192, 76);
-                else
-                  button_color = QColor(255, 188, 48);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && this->hovered() )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawLine( QPointF( 5, 9 ), QPointF( 13, 9 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::OnAllDesktops:
-            {
-                QColor button_color = QColor(125, 209, 200);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && ( this->hovered() || isChecked() ) )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( !isChecked() && ( this->hovered() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) )
-                {
-                  painter->setPen( symbol_pen );
-
-                  if ( !isHovered() && d->internalSettings()->animationsEnabled() ) {
-                    painter->drawLine( QPointF( 5, 5 ), QPointF( 13, 5 ) );
-                    painter->drawLine( QPointF( 13, 5 ), QPointF( 13, 13 ) );
-                    painter->drawLine( QPointF( 5, 5 ), QPointF( 5, 13 ) );
-                    painter->drawLine( QPointF( 5, 13 ), QPointF( 13, 13 ) );
-
-                    painter->setBrush(QBrush(symbolColor));
-                    painter->drawEllipse( c, 0.5, 0.5 );
-                  }
-                  else {
-                    painter->drawLine( QPointF( 7, 5 ), QPointF( 15, 5 ) );
-                    painter->drawLine( QPointF( 15, 5 ), QPointF( 15, 13 ) );
-                    painter->drawLine( QPointF( 7, 5 ), QPointF( 7, 13 ) );
-                    painter->drawLine( QPointF( 7, 13 ), QPointF( 15, 13 ) );
-
-                    painter->drawLine( QPointF( 3, 5 ), QPointF( 3, 13 ) );
-                    painter->drawLine( QPointF( 3, 5 ), QPointF( 4.5, 5 ) );
-                    painter->drawLine( QPointF( 3, 13 ), QPointF( 4.5, 13 ) );
-                  }
-                }
-                else if ( isChecked() && ( this->hovered() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) )
-                {
-                  painter->setPen( symbol_pen );
-
-                  painter->drawLine( QPointF( 5, 5 ), QPointF( 11, 5 ) );
-                  painter->drawLine( QPointF( 11, 5 ), QPointF( 11, 11 ) );
-                  painter->drawLine( QPointF( 5, 5 ), QPointF( 5, 11 ) );
-                  painter->drawLine( QPointF( 5, 11 ), QPointF( 11, 11 ) );
-
-                  painter->drawLine( QPointF( 7, 7 ), QPointF( 13, 7 ) );
-                  painter->drawLine( QPointF( 13, 7 ), QPointF( 13, 13 ) );
-                  painter->drawLine( QPointF( 7, 7 ), QPointF( 7, 13 ) );
-                  painter->drawLine( QPointF( 7, 13 ), QPointF( 13, 13 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::Shade:
-            {
-                QColor button_color = QColor(204, 176, 213);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && ( this->hovered() || isChecked() ) )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if (isChecked())
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawLine( QPointF( 4, 12 ), QPointF( 14, 12 ) );
-
-                  painter->setBrush(QBrush(symbolColor));
-                  painter->drawEllipse( QRectF( 8, 6, 2, 2 ) );
-                }
-                else if ( this->hovered() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawLine( QPointF( 4, 6 ), QPointF( 14, 6 ) );
-
-                  painter->setBrush(QBrush(symbolColor));
-                  painter->drawEllipse( QRectF( 8, 10, 2, 2 ) );
-                }
-                break;
-
-            }
-
-            case DecorationButtonType::KeepBelow:
-            {
-                QColor button_color = QColor(255, 137, 241);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && ( this->hovered() || isChecked() ) )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() ||  ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawPolyline( QVector<QPointF>{
-                           QPointF( 4, 7 ),
-                           QPointF( 9, 12 ),
-                           QPointF( 14, 7 ) });
-                }
-                break;
-
-            }
-
-            case DecorationButtonType::KeepAbove:
-            {
-                QColor button_color = QColor(135, 206, 249);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && ( this->hovered() || isChecked() ) )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() ||  ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( symbol_pen );
-                  painter->drawPolyline( QVector<QPointF>{
-                           QPointF( 4, 11 ),
-                           QPointF( 9, 6 ),
-                           QPointF( 14, 11 )});
-                }
-                break;
-            }
-
-            case DecorationButtonType::ApplicationMenu:
-            {
-                QColor menuSymbolColor;
-                bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-                if (isSystemForegroundColor)
-                  menuSymbolColor = this->fontColor();
-                else {
-                  uint r = qRed(titleBarColor.rgb());
-                  uint g = qGreen(titleBarColor.rgb());
-                  uint b = qBlue(titleBarColor.rgb());
-                  // modified from https://stackoverflow.com/questions/3942878/how-to-decide-font-color-in-white-or-black-depending-on-background-color
-                  // qreal titleBarLuminance = (0.2126 * static_cast<qreal>(r) + 0.7152 * static_cast<qreal>(g) + 0.0722 * static_cast<qreal>(b)) / 255.;
-                  // if ( titleBarLuminance >  sqrt(1.05 * 0.05) - 0.05 )
-                  qreal colorConditional = 0.299 * static_cast<qreal>(r) + 0.587 * static_cast<qreal>(g) + 0.114 * static_cast<qreal>(b);
-                  if ( colorConditional > 186 || g > 186 )
-                    menuSymbolColor = darkSymbolColor;
-                  else
-                    menuSymbolColor = lightSymbolColor;
-                }
-
-                QPen menuSymbol_pen( menuSymbolColor );
-                menuSymbol_pen.setJoinStyle( Qt::MiterJoin );
-                menuSymbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/width ) );
-
-                painter->setPen( menuSymbol_pen );
-
-                painter->drawLine( QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) );
-                painter->drawLine( QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) );
-                painter->drawLine( QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::ContextHelp:
-            {
-                QColor button_color = QColor(102, 156, 246);
-                QPen button_pen( qGray(titleBarColor.rgb()) < 69 ? button_color.lighter(115) : button_color.darker(115) );
-                button_pen.setJoinStyle( Qt::MiterJoin );
-                if ( d->internalSettings()->animationsEnabled() )
-                  button_pen.setWidthF( PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-                else
-                  button_pen.setWidthF( 9./7.*PenWidth::Symbol*qMax((qreal)1.0, 20/width ) );
-
-                if ( ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle ) && ( this->hovered() || isChecked() ) )
-                {
-                  // ring
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( button_pen );
-                }
-                else if ( ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  // nothing
-                  painter->setBrush( Qt::NoBrush );
-                  painter->setPen( Qt::NoPen );
-                }
-                else
-                {
-                  // filled
-                  painter->setBrush( button_color );
-                  painter->setPen( button_pen );
-                }
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                if ( this->hovered() || isChecked() || ( inactiveWindow && !useActiveButtonStyle ) || useInactiveButtonStyle )
-                {
-                  painter->setPen( symbol_pen );
-                  int startAngle = 260 * 16;
-                  int spanAngle = 280 * 16;
-                  painter->drawArc( QRectF( 6, 4, 6, 6), startAngle, spanAngle );
-
-                  painter->setBrush(QBrush(symbolColor));
-                  r = static_cast<qreal>(1);
-                  c = QPointF (static_cast<qreal>(9), static_cast<qreal>(13));
-                  painter->drawEllipse( c, r, r );
-                }
-                break;
-            }
-
-            default: break;
-        }
-    }
-
-    //__________________________________________________________________
-    void Button::drawIconSierraColorSymbols( QPainter *painter ) const
-    {
-        painter->setRenderHints( QPainter::Antialiasing );
-
-        /*
-        scale painter so that its window matches QRect( -1, -1, 20, 20 )
-        this makes all further rendering and scaling simpler
-        all further rendering is preformed inside QRect( 0, 0, 18, 18 )
-        */
-        painter->translate( geometry().topLeft() );
-
-        const qreal width( m_iconSize.width() );
-        painter->scale( width/20, width/20 );
-        painter->translate( 1, 1 );
-
-        auto d = qobject_cast<Decoration*>( decoration() );
-
-        bool inactiveWindow( d && !d->client().toStrongRef().data()->isActive() );
-        bool isMatchTitleBarColor( d && d->internalSettings()->matchColorForTitleBar() );
-
-        QColor darkSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(81, 102, 107) : QColor(34, 45, 50) );
-        QColor lightSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(192, 193, 194) : QColor(250, 251, 252) );
-
-        QColor titleBarColor (d->titleBarColor());
-
-        // symbols color
-
-        QColor symbolColor;
-        bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-        if (isSystemForegroundColor)
-          symbolColor = this->fontColor();
-        else {
-          if ( inactiveWindow && qGray(titleBarColor.rgb()) < 128 )
-              symbolColor = lightSymbolColor;
-          else if ( inactiveWindow && qGray(titleBarColor.rgb()) > 128 )
-              symbolColor = darkSymbolColor;
-          else
-              symbolColor = this->autoColor( false, true, false, darkSymbolColor, lightSymbolColor );
-        }
-
-        // symbols pen
-
-        QPen symbol_pen( symbolColor );
-        symbol_pen.setJoinStyle( Qt::MiterJoin );
-        symbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/width ) );
-
-        switch( type() )
-        {
-
-            case DecorationButtonType::Close:
-            {
-                QColor  button_color = QColor(238, 102, 90);
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                // it's a cross
-                painter->drawLine( QPointF( 6, 6 ), QPointF( 12, 12 ) );
-                painter->drawLine( QPointF( 6, 12 ), QPointF( 12, 6 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::Maximize:
-            {
-                QColor button_color = QColor(100, 196, 86);
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-                painter->setPen( Qt::NoPen );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-
-                // two triangles
-                QPainterPath path1, path2;
-                if( isChecked() )
-                {
-                    path1.moveTo(8.5, 9.5);
-                    path1.lineTo(2.5, 9.5);
-                    path1.lineTo(8.5, 15.5);
-
-                    path2.moveTo(9.5, 8.5);
-                    path2.lineTo(15.5, 8.5);
-                    path2.lineTo(9.5, 2.5);
-                }
-                else
-                {
-                    path1.moveTo(5, 13);
-                    path1.lineTo(11, 13);
-                    path1.lineTo(5, 7);
-
-                    path2.moveTo(13, 5);
-                    path2.lineTo(7, 5);
-                    path2.lineTo(13, 11);
-                }
-
-                painter->fillPath(path1, QBrush(mycolor));
-                painter->fillPath(path2, QBrush(mycolor));
-
-                break;
-            }
-
-            case DecorationButtonType::Minimize:
-            {
-                QColor button_color = QColor(223, 192, 76);
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                // it's a horizontal line
-                painter->drawLine( QPointF( 5, 9 ), QPointF( 13, 9 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::OnAllDesktops:
-            {
-                QColor button_color = QColor(125, 209, 200);
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( !isChecked() )
-                    mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                // painter->setPen( symbol_pen );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush(QBrush(mycolor));
-                painter->drawEllipse( QRectF( 6, 6, 6, 6 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::Shade:
-            {
-                QColor button_color = QColor(204, 176, 213);
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( !isChecked() )
-                  mycolor = this->mixColors(button_color.darker (100), symbolColor, m_opacity);
-                painter->setPen( mycolor );
-
-                // it's a triangle with a dash
-                if (isChecked())
-                {
-                    painter->setPen( symbol_pen );
-                    painter->drawLine( QPointF( 6, 12 ), QPointF( 12, 12 ) );
-                    painter->setPen( Qt::NoPen );
-                    QPainterPath path;
-                    path.moveTo(9, 11);
-                    path.lineTo(5, 6);
-                    path.lineTo(13, 6);
-                    painter->fillPath(path, QBrush(mycolor));
-
-                }
-                else {
-                    painter->drawLine( QPointF( 6, 6 ), QPointF( 12, 6 ) );
-                    painter->setPen( Qt::NoPen );
-                    QPainterPath path;
-                    path.moveTo(9, 7);
-                    path.lineTo(5, 12);
-                    path.lineTo(13, 12);
-                    painter->fillPath(path, QBrush(mycolor));
-                }
-
-                break;
-
-            }
-
-            case DecorationButtonType::KeepBelow:
-            {
-                QColor button_color = QColor(255, 137, 241);
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( !isChecked() )
-                    mycolor = this->mixColors(button_color.darker (100), symbolColor, m_opacity);
-                painter->setPen( Qt::NoPen );
-
-                // it's a downward pointing triangle
-                QPainterPath path;
-                path.moveTo(9, 12);
-                path.lineTo(5, 6);
-                path.lineTo(13, 6);
-                painter->fillPath(path, QBrush(mycolor));
-
-                break;
-
-            }
-
-            case DecorationButtonType::KeepAbove:
-            {
-                QColor button_color = QColor(135, 206, 249);
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( !isChecked() )
-                    mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                painter->setPen( Qt::NoPen );
-
-                // it's a upward pointing triangle
-                QPainterPath path;
-                path.moveTo(9, 6);
-                path.lineTo(5, 12);
-                path.lineTo(13, 12);
-                painter->fillPath(path, QBrush(mycolor));
-
-                break;
-            }
-
-            case DecorationButtonType::ApplicationMenu:
-            {
-                QColor menuSymbolColor;
-                bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-                if (isSystemForegroundColor)
-                  menuSymbolColor = this->fontColor();
-                else {
-                  uint r = qRed(titleBarColor.rgb());
-                  uint g = qGreen(titleBarColor.rgb());
-                  uint b = qBlue(titleBarColor.rgb());
-                  // modified from https://stackoverflow.com/questions/3942878/how-to-decide-font-color-in-white-or-black-depending-on-background-color
-                  // qreal titleBarLuminance = (0.2126 * static_cast<qreal>(r) + 0.7152 * static_cast<qreal>(g) + 0.0722 * static_cast<qreal>(b)) / 255.;
-                  // if ( titleBarLuminance >  sqrt(1.05 * 0.05) - 0.05 )
-                  qreal colorConditional = 0.299 * static_cast<qreal>(r) + 0.587 * static_cast<qreal>(g) + 0.114 * static_cast<qreal>(b);
-                  if ( colorConditional > 186 || g > 186 )
-                    menuSymbolColor = darkSymbolColor;
-                  else
-                    menuSymbolColor = lightSymbolColor;
-                }
-
-                QPen menuSymbol_pen( menuSymbolColor );
-                menuSymbol_pen.setJoinStyle( Qt::MiterJoin );
-                menuSymbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/width ) );
-
-                painter->setPen( menuSymbol_pen );
-
-                painter->drawLine( QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) );
-                painter->drawLine( QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) );
-                painter->drawLine( QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::ContextHelp:
-            {
-                QColor button_color = QColor(102, 156, 246);
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                // it's a question mark
-                QPainterPath path;
-                path.moveTo( 6, 6 );
-                path.arcTo( QRectF( 5.5, 4, 7.5, 4.5 ), 180, -180 );
-                path.cubicTo( QPointF(11, 9), QPointF( 9, 6 ), QPointF( 9, 10 ) );
-                painter->drawPath( path );
-                painter->drawPoint( 9, 13 );
-
-                break;
-            }
-
-            default: break;
-        }
-    }
-
-    //__________________________________________________________________
-    void Button::drawIconDarkAuroraeColorSymbols( QPainter *painter ) const
-    {
-        painter->setRenderHints( QPainter::Antialiasing );
-
-        /*
-        scale painter so that its window matches QRect( -1, -1, 20, 20 )
-        this makes all further rendering and scaling simpler
-        all further rendering is preformed inside QRect( 0, 0, 18, 18 )
-        */
-        painter->translate( geometry().topLeft() );
-
-        const qreal width( m_iconSize.width() );
-        painter->scale( width/20, width/20 );
-        painter->translate( 1, 1 );
-
-        auto d = qobject_cast<Decoration*>( decoration() );
-
-        bool inactiveWindow( d && !d->client().toStrongRef().data()->isActive() );
-        bool isMatchTitleBarColor( d && d->internalSettings()->matchColorForTitleBar() );
-
-        QColor darkSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(81, 102, 107) : QColor(34, 45, 50) );
-        QColor lightSymbolColor( ( inactiveWindow && isMatchTitleBarColor ) ? QColor(192, 193, 194) : QColor(250, 251, 252) );
-
-        QColor titleBarColor (d->titleBarColor());
-
-        // symbols color
-
-        QColor symbolColor;
-        bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-        if (isSystemForegroundColor)
-          symbolColor = this->fontColor();
-        else {
-          if ( inactiveWindow && qGray(titleBarColor.rgb()) < 128 )
-              symbolColor = lightSymbolColor;
-          else if ( inactiveWindow && qGray(titleBarColor.rgb()) > 128 )
-              symbolColor = darkSymbolColor;
-          else
-              symbolColor = this->autoColor( false, true, false, darkSymbolColor, lightSymbolColor );
-        }
-
-        // symbols pen
-
-        QPen symbol_pen( symbolColor );
-        symbol_pen.setJoinStyle( Qt::MiterJoin );
-        symbol_pen.setWidthF( 1.2*qMax((qreal)1.0, 20/width ) );
-
-        switch( type() )
-        {
-
-            case DecorationButtonType::Close:
-            {
-                QColor button_color = QColor(238, 102, 90);
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                // it's a cross
-                painter->drawLine( QPointF( 5, 5 ), QPointF( 13, 13 ) );
-                painter->drawLine( QPointF( 5, 13 ), QPointF( 13, 5 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::Maximize:
-            {
-                QColor button_color = QColor(100, 196, 86);
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-
-                // solid vs. open rectangle
-                if( isChecked() )
-                {
-                    painter->drawLine( QPointF( 4.5, 6 ), QPointF( 13.5, 6 ) );
-                    painter->drawLine( QPointF( 13.5, 6 ), QPointF( 13.5, 12 ) );
-                    painter->drawLine( QPointF( 4.5, 6 ), QPointF( 4.5, 12 ) );
-                    painter->drawLine( QPointF( 4.5, 12 ), QPointF( 13.5, 12 ) );
-                }
-                else
-                {
-                    painter->drawLine( QPointF( 4.5, 4.5 ), QPointF( 13.5, 4.5 ) );
-                    painter->drawLine( QPointF( 13.5, 4.5 ), QPointF( 13.5, 9 ) );
-                    painter->drawLine( QPointF( 4.5, 9 ), QPointF( 4.5, 13.5 ) );
-                    painter->drawLine( QPointF( 4.5, 13.5 ), QPointF( 13.5, 13.5 ) );
-                }
-
-                break;
-            }
-
-            case DecorationButtonType::Minimize:
-            {
-                QColor button_color = QColor(223, 192, 76);
-
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                // it's a horizontal line
-                painter->drawLine( QPointF( 5, 9 ), QPointF( 13, 9 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::OnAllDesktops:
-            {
-                QColor button_color = QColor(125, 209, 200);
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( !isChecked() )
-                  mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-
-                if (isChecked())
-                {
-                  painter->drawLine( QPointF( 5, 5 ), QPointF( 11, 5 ) );
-                  painter->drawLine( QPointF( 11, 5 ), QPointF( 11, 11 ) );
-                  painter->drawLine( QPointF( 5, 5 ), QPointF( 5, 11 ) );
-                  painter->drawLine( QPointF( 5, 11 ), QPointF( 11, 11 ) );
-
-                  painter->drawLine( QPointF( 7, 7 ), QPointF( 13, 7 ) );
-                  painter->drawLine( QPointF( 13, 7 ), QPointF( 13, 13 ) );
-                  painter->drawLine( QPointF( 7, 7 ), QPointF( 7, 13 ) );
-                  painter->drawLine( QPointF( 7, 13 ), QPointF( 13, 13 ) );
-                }
-                else {
-                  painter->drawLine( QPointF( 7, 5 ), QPointF( 15, 5 ) );
-                  painter->drawLine( QPointF( 15, 5 ), QPointF( 15, 13 ) );
-                  painter->drawLine( QPointF( 7, 5 ), QPointF( 7, 13 ) );
-                  painter->drawLine( QPointF( 7, 13 ), QPointF( 15, 13 ) );
-
-                  painter->drawLine( QPointF( 3, 5 ), QPointF( 3, 13 ) );
-                  painter->drawLine( QPointF( 3, 5 ), QPointF( 4.5, 5 ) );
-                  painter->drawLine( QPointF( 3, 13 ), QPointF( 4.5, 13 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::Shade:
-            {
-                QColor button_color = QColor(204, 176, 213);
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( !isChecked() )
-                  mycolor = this->mixColors(button_color.darker (100), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                if (isChecked())
-                {
-                  painter->drawLine( QPointF( 4, 12 ), QPointF( 14, 12 ) );
-                  painter->setBrush(QBrush(symbolColor));
-                  painter->drawEllipse( QRectF( 8, 6, 2, 2 ) );
-                }
-                else {
-                  painter->drawLine( QPointF( 4, 6 ), QPointF( 14, 6 ) );
-                  painter->setBrush(QBrush(mycolor));
-                  painter->drawEllipse( QRectF( 8, 10, 2, 2 ) );
-                }
-
-                break;
-
-            }
-
-            case DecorationButtonType::KeepBelow:
-            {
-                QColor button_color = QColor(255, 137, 241);
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( !isChecked() )
-                  mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                painter->drawPolyline( QVector<QPointF>{
-                           QPointF( 4, 7 ),
-                           QPointF( 9, 12 ),
-                           QPointF( 14, 7 ) });
-
-                break;
-
-            }
-
-            case DecorationButtonType::KeepAbove:
-            {
-                QColor button_color = QColor(135, 206, 249);
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( !isChecked() )
-                  mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                painter->drawPolyline( QVector<QPointF>{
-                           QPointF( 4, 11 ),
-                           QPointF( 9, 6 ),
-                           QPointF( 14, 11 )});
-
-                break;
-            }
-
-            case DecorationButtonType::ApplicationMenu:
-            {
-                QColor menuSymbolColor;
-                bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-                if (isSystemForegroundColor)
-                  menuSymbolColor = this->fontColor();
-                else {
-                  uint r = qRed(titleBarColor.rgb());
-                  uint g = qGreen(titleBarColor.rgb());
-                  uint b = qBlue(titleBarColor.rgb());
-                  // modified from https://stackoverflow.com/questions/3942878/how-to-decide-font-color-in-white-or-black-depending-on-background-color
-                  // qreal titleBarLuminance = (0.2126 * static_cast<qreal>(r) + 0.7152 * static_cast<qreal>(g) + 0.0722 * static_cast<qreal>(b)) / 255.;
-                  // if ( titleBarLuminance >  sqrt(1.05 * 0.05) - 0.05 )
-                  qreal colorConditional = 0.299 * static_cast<qreal>(r) + 0.587 * static_cast<qreal>(g) + 0.114 * static_cast<qreal>(b);
-                  if ( colorConditional > 186 || g > 186 )
-                    menuSymbolColor = darkSymbolColor;
-                  else
-                    menuSymbolColor = lightSymbolColor;
-                }
-
-                QPen menuSymbol_pen( menuSymbolColor );
-                menuSymbol_pen.setJoinStyle( Qt::MiterJoin );
-                menuSymbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/width ) );
-
-                painter->setPen( menuSymbol_pen );
-
-                painter->drawLine( QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) );
-                painter->drawLine( QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) );
-                painter->drawLine( QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::ContextHelp:
-            {
-                QColor button_color = QColor(102, 156, 246);
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color.darker( 100 ), symbolColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                // it's a question mark
-
-                painter->setPen( symbol_pen );
-                int startAngle = 260 * 16;
-                int spanAngle = 280 * 16;
-                painter->drawArc( QRectF( 6, 4, 6, 6), startAngle, spanAngle );
-
-                painter->setBrush(QBrush(symbolColor));
-                r = static_cast<qreal>(1);
-                c = QPointF (static_cast<qreal>(9), static_cast<qreal>(13));
-                painter->drawEllipse( c, r, r );
-
-                break;
-            }
-
-            default: break;
-        }
-    }
-
-    //__________________________________________________________________
-    void Button::drawIconSierraMonochromeSymbols( QPainter *painter ) const
-    {
-        painter->setRenderHints( QPainter::Antialiasing );
-
-        /*
-         *        scale painter so that its window matches QRect( -1, -1, 20, 20 )
-         *        this makes all further rendering and scaling simpler
-         *        all further rendering is preformed inside QRect( 0, 0, 18, 18 )
-         */
-        painter->translate( geometry().topLeft() );
-
-        const qreal width( m_iconSize.width() );
-        painter->scale( width/20, width/20 );
-        painter->translate( 1, 1 );
-
-        QColor darkSymbolColor = QColor(34, 45, 50);
-        QColor lightSymbolColor = QColor(250, 251, 252);
-
-        auto d = qobject_cast<Decoration*>( decoration() );
-        QColor titleBarColor (d->titleBarColor());
-
-        QColor symbolColor;
-        QColor symbolBgdColor;
-        bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-        if (isSystemForegroundColor) {
-          symbolColor = this->foregroundColor();
-          symbolBgdColor = this->backgroundColor();
-        } else {
-          uint r = qRed(titleBarColor.rgb());
-          uint g = qGreen(titleBarColor.rgb());
-          uint b = qBlue(titleBarColor.rgb());
-
-          // modified from https://stackoverflow.com/questions/3942878/how-to-decide-font-color-in-white-or-black-depending-on-background-color
-          // qreal titleBarLuminance = (0.2126 * static_cast<qreal>(r) + 0.7152 * static_cast<qreal>(g) + 0.0722 * static_cast<qreal>(b)) / 255.;
-          // if ( titleBarLuminance >  sqrt(1.05 * 0.05) - 0.05 )
-          qreal colorConditional = 0.299 * static_cast<qreal>(r) + 0.587 * static_cast<qreal>(g) + 0.114 * static_cast<qreal>(b);
-          if ( colorConditional > 186 || g > 186 ) {
-            symbolColor = darkSymbolColor;
-            symbolBgdColor = lightSymbolColor;
-          }
-          else {
-            symbolColor = lightSymbolColor;
-            symbolBgdColor = darkSymbolColor;
-          }
-        }
-
-        // symbols pen
-
-        QPen symbol_pen( symbolColor );
-        symbol_pen.setJoinStyle( Qt::MiterJoin );
-        symbol_pen.setWidthF( 1.7*qMax((qreal)1.0, 20/width ) );
-
-        switch( type() )
-        {
-
-          case DecorationButtonType::Close:
-          {
-            QColor button_color = symbolColor;
-            button_color.setAlpha( button_color.alpha()*m_opacity );
-            painter->setPen( Qt::NoPen );
-            painter->setBrush( button_color );
-
-            qreal r = static_cast<qreal>(7)
-            + static_cast<qreal>(2) * m_animation->currentValue().toReal();
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-            painter->drawEllipse( c, r, r );
-            painter->setBrush( Qt::NoBrush );
-
-            button_color.setAlpha( 255 );
-            symbolBgdColor.setAlpha( 255 );
-            QColor mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-            symbol_pen.setColor(mycolor);
-            painter->setPen( symbol_pen );
-            // it's a cross
-            painter->drawLine( QPointF( 6, 6 ), QPointF( 12, 12 ) );
-            painter->drawLine( QPointF( 6, 12 ), QPointF( 12, 6 ) );
-
-            break;
-          }
-
-          case DecorationButtonType::Maximize:
-          {
-            QColor button_color = symbolColor;
-            button_color.setAlpha( button_color.alpha()*m_opacity );
-            painter->setPen( Qt::NoPen );
-            painter->setBrush( button_color );
-
-            qreal r = static_cast<qreal>(7)
-            + static_cast<qreal>(2) * m_animation->currentValue().toReal();
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-            painter->drawEllipse( c, r, r );
-            painter->setBrush( Qt::NoBrush );
-            painter->setPen( Qt::NoPen );
-
-            button_color.setAlpha( 255 );
-            symbolBgdColor.setAlpha( 255 );
-            QColor mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-
-            // two triangles
-            QPainterPath path1, path2;
-            if( isChecked() )
-            {
-              path1.moveTo(8.5, 9.5);
-              path1.lineTo(2.5, 9.5);
-              path1.lineTo(8.5, 15.5);
-
-              path2.moveTo(9.5, 8.5);
-              path2.lineTo(15.5, 8.5);
-              path2.lineTo(9.5, 2.5);
-            }
-            else
-            {
-              path1.moveTo(5, 13);
-              path1.lineTo(11, 13);
-              path1.lineTo(5, 7);
-
-              path2.moveTo(13, 5);
-              path2.lineTo(7, 5);
-              path2.lineTo(13, 11);
-            }
-
-            painter->fillPath(path1, QBrush(mycolor));
-            painter->fillPath(path2, QBrush(mycolor));
-
-            break;
-        }
-
-        case DecorationButtonType::Minimize:
-        {
-          QColor button_color = symbolColor;
-          button_color.setAlpha( button_color.alpha()*m_opacity );
-          painter->setPen( Qt::NoPen );
-          painter->setBrush( button_color );
-
-          qreal r = static_cast<qreal>(7)
-          + static_cast<qreal>(2) * m_animation->currentValue().toReal();
-          QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-          painter->drawEllipse( c, r, r );
-          painter->setBrush( Qt::NoBrush );
-
-          button_color.setAlpha( 255 );
-          symbolBgdColor.setAlpha( 255 );
-          QColor mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-          symbol_pen.setColor(mycolor);
-          painter->setPen( symbol_pen );
-          // it's a horizontal line
-          painter->drawLine( QPointF( 5, 9 ), QPointF( 13, 9 ) );
-
-          break;
-        }
-
-        case DecorationButtonType::OnAllDesktops:
-        {
-          QColor button_color = symbolColor;
-          if ( !isChecked() )
-            button_color.setAlpha( button_color.alpha()*m_opacity );
-          painter->setPen( Qt::NoPen );
-          painter->setBrush( button_color );
-
-          if ( !isChecked() ) {
-            qreal r = static_cast<qreal>(7)
-                      + static_cast<qreal>(2) * m_animation->currentValue().toReal();
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-            painter->drawEllipse( c, r, r );
-          }
-          else {
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                  painter->drawEllipse( c, 9, 9 );
-          }
-          painter->setBrush( Qt::NoBrush );
-
-          button_color.setAlpha( 255 );
-          symbolBgdColor.setAlpha( 255 );
-          QColor mycolor = symbolColor;
-          if ( isChecked() && !this->hovered() )
-            mycolor = this->mixColors(symbolBgdColor, button_color, m_opacity);
-          else
-            mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-          symbol_pen.setColor(mycolor);
-          painter->setPen( Qt::NoPen );
-          painter->setBrush(QBrush(mycolor));
-          painter->drawEllipse( QRectF( 6, 6, 6, 6 ) );
-
-          break;
-        }
-
-        case DecorationButtonType::Shade:
-        {
-          QColor button_color = symbolColor;
-          if ( !isChecked() )
-              button_color.setAlpha( button_color.alpha()*m_opacity );
-          painter->setPen( Qt::NoPen );
-          painter->setBrush( button_color );
-
-          if ( !isChecked() ) {
-            qreal r = static_cast<qreal>(7)
-                      + static_cast<qreal>(2) * m_animation->currentValue().toReal();
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-            painter->drawEllipse( c, r, r );
-          }
-          else {
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                  painter->drawEllipse( c, 9, 9 );
-          }
-          painter->setBrush( Qt::NoBrush );
-
-          button_color.setAlpha( 255 );
-          symbolBgdColor.setAlpha( 255 );
-          QColor mycolor = symbolColor;
-          if ( isChecked() && !this->hovered() )
-            mycolor = this->mixColors(symbolBgdColor, button_color, m_opacity);
-          else
-            mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-          symbol_pen.setColor(mycolor);
-          painter->setPen( symbol_pen );
-          // it's a triangle with a dash
-          if (isChecked())
-          {
-            painter->setPen( symbol_pen );
-            painter->drawLine( QPointF( 6, 12 ), QPointF( 12, 12 ) );
-            painter->setPen( Qt::NoPen );
-            QPainterPath path;
-            path.moveTo(9, 11);
-            path.lineTo(5, 6);
-            path.lineTo(13, 6);
-            painter->fillPath(path, QBrush(mycolor));
-          }
-          else {
-            painter->setPen( symbol_pen );
-            painter->drawLine( QPointF( 6, 6 ), QPointF( 12, 6 ) );
-            painter->setPen( Qt::NoPen );
-            QPainterPath path;
-            path.moveTo(9, 7);
-            path.lineTo(5, 12);
-            path.lineTo(13, 12);
-            painter->fillPath(path, QBrush(mycolor));
-          }
-
-          break;
-
-        }
-
-        case DecorationButtonType::KeepBelow:
-        {
-          QColor button_color = symbolColor;
-          if ( !isChecked() )
-            button_color.setAlpha( button_color.alpha()*m_opacity );
-          painter->setPen( Qt::NoPen );
-          painter->setBrush( button_color );
-
-          if ( !isChecked() ) {
-            qreal r = static_cast<qreal>(7)
-                      + static_cast<qreal>(2) * m_animation->currentValue().toReal();
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-            painter->drawEllipse( c, r, r );
-          }
-          else {
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                  painter->drawEllipse( c, 9, 9 );
-          }
-          painter->setBrush( Qt::NoBrush );
-
-          button_color.setAlpha( 255 );
-          symbolBgdColor.setAlpha( 255 );
-          QColor mycolor = symbolColor;
-          if ( isChecked() && !this->hovered() )
-            mycolor = this->mixColors(symbolBgdColor, button_color, m_opacity);
-          else
-            mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-          painter->setPen( Qt::NoPen );
-
-          // it's a downward pointing triangle
-          QPainterPath path;
-          path.moveTo(9, 12);
-          path.lineTo(5, 6);
-          path.lineTo(13, 6);
-          painter->fillPath(path, QBrush(mycolor));
-
-          break;
-
-        }
-
-        case DecorationButtonType::KeepAbove:
-        {
-          QColor button_color = symbolColor;
-          if ( !isChecked() )
-            button_color.setAlpha( button_color.alpha()*m_opacity );
-          painter->setPen( Qt::NoPen );
-          painter->setBrush( button_color );
-
-          if ( !isChecked() ) {
-            qreal r = static_cast<qreal>(7)
-                      + static_cast<qreal>(2) * m_animation->currentValue().toReal();
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-            painter->drawEllipse( c, r, r );
-          }
-          else {
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                  painter->drawEllipse( c, 9, 9 );
-          }
-          painter->setBrush( Qt::NoBrush );
-
-          button_color.setAlpha( 255 );
-          symbolBgdColor.setAlpha( 255 );
-          QColor mycolor = symbolColor;
-          if ( isChecked() && !this->hovered() )
-            mycolor = this->mixColors(symbolBgdColor, button_color, m_opacity);
-          else
-            mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-          painter->setPen( Qt::NoPen );
-
-          // it's a upward pointing triangle
-          QPainterPath path;
-          path.moveTo(9, 6);
-          path.lineTo(5, 12);
-          path.lineTo(13, 12);
-          painter->fillPath(path, QBrush(mycolor));
-
-          break;
-        }
-
-        case DecorationButtonType::ApplicationMenu:
-        {
-          painter->setPen( symbol_pen );
-
-          painter->drawLine( QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) );
-          painter->drawLine( QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) );
-          painter->drawLine( QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) );
-
-          break;
-        }
-
-        case DecorationButtonType::ContextHelp:
-        {
-          QColor button_color = symbolColor;
-          button_color.setAlpha( button_color.alpha()*m_opacity );
-          painter->setPen( Qt::NoPen );
-          painter->setBrush( button_color );
-
-          if ( !isChecked() ) {
-            qreal r = static_cast<qreal>(7)
-                      + static_cast<qreal>(2) * m_animation->currentValue().toReal();
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-            painter->drawEllipse( c, r, r );
-          }
-          else {
-            QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                  painter->drawEllipse( c, 9, 9 );
-          }
-          painter->setBrush( Qt::NoBrush );
-
-          button_color.setAlpha( 255 );
-          symbolBgdColor.setAlpha( 255 );
-          QColor mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-          symbol_pen.setColor(mycolor);
-          painter->setPen( symbol_pen );
-
-          // it's a question mark
-
-          QPainterPath path;
-          path.moveTo( 6, 6 );
-          path.arcTo( QRectF( 5.5, 4, 7.5, 4.5 ), 180, -180 );
-          path.cubicTo( QPointF(11, 9), QPointF( 9, 6 ), QPointF( 9, 10 ) );
-          painter->drawPath( path );
-          painter->drawPoint( 9, 13 );
-
-          break;
-        }
-
-        default: break;
-      }
-    }
-
-    //__________________________________________________________________
-    void Button::drawIconDarkAuroraeMonochromeSymbols( QPainter *painter ) const
-    {
-        painter->setRenderHints( QPainter::Antialiasing );
-
-        /*
-        scale painter so that its window matches QRect( -1, -1, 20, 20 )
-        this makes all further rendering and scaling simpler
-        all further rendering is preformed inside QRect( 0, 0, 18, 18 )
-        */
-        painter->translate( geometry().topLeft() );
-
-        const qreal width( m_iconSize.width() );
-        painter->scale( width/20, width/20 );
-        painter->translate( 1, 1 );
-
-        QColor darkSymbolColor = QColor(34, 45, 50);
-        QColor lightSymbolColor = QColor(250, 251, 252);
-
-        auto d = qobject_cast<Decoration*>( decoration() );
-        QColor titleBarColor (d->titleBarColor());
-
-        QColor symbolColor;
-        QColor symbolBgdColor;
-
-        bool isSystemForegroundColor( d && d->internalSettings()->systemForegroundColor() );
-        if (isSystemForegroundColor) {
-          symbolColor = this->foregroundColor();
-          symbolBgdColor = this->backgroundColor();
-        } else {
-          uint r = qRed(titleBarColor.rgb());
-          uint g = qGreen(titleBarColor.rgb());
-          uint b = qBlue(titleBarColor.rgb());
-
-          // modified from https://stackoverflow.com/questions/3942878/how-to-decide-font-color-in-white-or-black-depending-on-background-color
-          // qreal titleBarLuminance = (0.2126 * static_cast<qreal>(r) + 0.7152 * static_cast<qreal>(g) + 0.0722 * static_cast<qreal>(b)) / 255.;
-          // if ( titleBarLuminance >  sqrt(1.05 * 0.05) - 0.05 )
-          qreal colorConditional = 0.299 * static_cast<qreal>(r) + 0.587 * static_cast<qreal>(g) + 0.114 * static_cast<qreal>(b);
-          if ( colorConditional > 186 || g > 186 ) {
-            symbolColor = darkSymbolColor;
-            symbolBgdColor = lightSymbolColor;
-          }
-          else {
-            symbolColor = lightSymbolColor;
-            symbolBgdColor = darkSymbolColor;
-          }
-        }
-
-        // symbols pen
-
-        QPen symbol_pen( symbolColor );
-        symbol_pen.setJoinStyle( Qt::MiterJoin );
-        symbol_pen.setWidthF( 1.2*qMax((qreal)1.0, 20/width ) );
-
-        switch( type() )
-        {
-
-            case DecorationButtonType::Close:
-            {
-                QColor button_color = symbolColor;
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                symbolBgdColor.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                // it's a cross
-                painter->drawLine( QPointF( 5, 5 ), QPointF( 13, 13 ) );
-                painter->drawLine( QPointF( 5, 13 ), QPointF( 13, 5 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::Maximize:
-            {
-                QColor button_color = symbolColor;
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                symbolBgdColor.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-
-                // solid vs. open rectangle
-                if( isChecked() )
-                {
-                    painter->drawLine( QPointF( 4.5, 6 ), QPointF( 13.5, 6 ) );
-                    painter->drawLine( QPointF( 13.5, 6 ), QPointF( 13.5, 12 ) );
-                    painter->drawLine( QPointF( 4.5, 6 ), QPointF( 4.5, 12 ) );
-                    painter->drawLine( QPointF( 4.5, 12 ), QPointF( 13.5, 12 ) );
-                }
-                else
-                {
-                    painter->drawLine( QPointF( 4.5, 4.5 ), QPointF( 13.5, 4.5 ) );
-                    painter->drawLine( QPointF( 13.5, 4.5 ), QPointF( 13.5, 9 ) );
-                    painter->drawLine( QPointF( 4.5, 9 ), QPointF( 4.5, 13.5 ) );
-                    painter->drawLine( QPointF( 4.5, 13.5 ), QPointF( 13.5, 13.5 ) );
-                }
-
-                break;
-            }
-
-            case DecorationButtonType::Minimize:
-            {
-                QColor button_color = symbolColor;
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                symbolBgdColor.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                // it's a horizontal line
-                painter->drawLine( QPointF( 5, 9 ), QPointF( 13, 9 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::OnAllDesktops:
-            {
-                QColor button_color = symbolColor;
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                symbolBgdColor.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( isChecked() && !this->hovered() )
-                  mycolor = this->mixColors(symbolBgdColor, button_color, m_opacity);
-                else
-                  mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-
-                if (isChecked())
-                {
-                  painter->drawLine( QPointF( 5, 5 ), QPointF( 11, 5 ) );
-                  painter->drawLine( QPointF( 11, 5 ), QPointF( 11, 11 ) );
-                  painter->drawLine( QPointF( 5, 5 ), QPointF( 5, 11 ) );
-                  painter->drawLine( QPointF( 5, 11 ), QPointF( 11, 11 ) );
-
-                  painter->drawLine( QPointF( 7, 7 ), QPointF( 13, 7 ) );
-                  painter->drawLine( QPointF( 13, 7 ), QPointF( 13, 13 ) );
-                  painter->drawLine( QPointF( 7, 7 ), QPointF( 7, 13 ) );
-                  painter->drawLine( QPointF( 7, 13 ), QPointF( 13, 13 ) );
-                }
-                else {
-                  painter->drawLine( QPointF( 7, 5 ), QPointF( 15, 5 ) );
-                  painter->drawLine( QPointF( 15, 5 ), QPointF( 15, 13 ) );
-                  painter->drawLine( QPointF( 7, 5 ), QPointF( 7, 13 ) );
-                  painter->drawLine( QPointF( 7, 13 ), QPointF( 15, 13 ) );
-
-                  painter->drawLine( QPointF( 3, 5 ), QPointF( 3, 13 ) );
-                  painter->drawLine( QPointF( 3, 5 ), QPointF( 4.5, 5 ) );
-                  painter->drawLine( QPointF( 3, 13 ), QPointF( 4.5, 13 ) );
-                }
-                break;
-            }
-
-            case DecorationButtonType::Shade:
-            {
-                QColor button_color = symbolColor;
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                symbolBgdColor.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( isChecked() && !this->hovered() )
-                  mycolor = this->mixColors(symbolBgdColor, button_color, m_opacity);
-                else
-                  mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                if (isChecked())
-                {
-                  painter->drawLine( QPointF( 4, 12 ), QPointF( 14, 12 ) );
-                  painter->setBrush(QBrush(symbolColor));
-                  painter->drawEllipse( QRectF( 8, 6, 2, 2 ) );
-                }
-                else {
-                  painter->drawLine( QPointF( 4, 6 ), QPointF( 14, 6 ) );
-                  painter->setBrush(QBrush(mycolor));
-                  painter->drawEllipse( QRectF( 8, 10, 2, 2 ) );
-                }
-
-                break;
-
-            }
-
-            case DecorationButtonType::KeepBelow:
-            {
-                QColor button_color = symbolColor;
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                symbolBgdColor.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( isChecked() && !this->hovered() )
-                  mycolor = this->mixColors(symbolBgdColor, button_color, m_opacity);
-                else
-                  mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                painter->drawPolyline( QVector<QPointF>{
-                           QPointF( 4, 7 ),
-                           QPointF( 9, 12 ),
-                           QPointF( 14, 7 ) });
-
-                break;
-
-            }
-
-            case DecorationButtonType::KeepAbove:
-            {
-                QColor button_color = symbolColor;
-                if ( !isChecked() )
-                    button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                symbolBgdColor.setAlpha( 255 );
-                QColor mycolor = symbolColor;
-                if ( isChecked() && !this->hovered() )
-                  mycolor = this->mixColors(symbolBgdColor, button_color, m_opacity);
-                else
-                  mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-                painter->drawPolyline( QVector<QPointF>{
-                           QPointF( 4, 11 ),
-                           QPointF( 9, 6 ),
-                           QPointF( 14, 11 )});
-
-                break;
-            }
-
-            case DecorationButtonType::ApplicationMenu:
-            {
-                painter->setPen( symbol_pen );
-
-                painter->drawLine( QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) );
-                painter->drawLine( QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) );
-                painter->drawLine( QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) );
-
-                break;
-            }
-
-            case DecorationButtonType::ContextHelp:
-            {
-                QColor button_color = symbolColor;
-                button_color.setAlpha( button_color.alpha()*m_opacity );
-                painter->setPen( Qt::NoPen );
-                painter->setBrush( button_color );
-
-                qreal r = this->buttonRadius();
-                QPointF c(static_cast<qreal>(9), static_cast<qreal>(9));
-                painter->drawEllipse( c, r, r );
-                painter->setBrush( Qt::NoBrush );
-
-                button_color.setAlpha( 255 );
-                symbolBgdColor.setAlpha( 255 );
-                QColor mycolor = this->mixColors(button_color, symbolBgdColor, m_opacity);
-                symbol_pen.setColor(mycolor);
-                painter->setPen( symbol_pen );
-
-                // it's a question mark
-
-                painter->setPen( symbol_pen );
-                int startAngle = 260 * 16;
-                int spanAngle = 280 * 16;
-                painter->drawArc( QRectF( 6, 4, 6, 6), startAngle, spanAngle );
-
-                painter->setBrush(QBrush(symbolColor));
-                r = static_cast<qreal>(1);
-                c = QPointF (static_cast<qreal>(9), static_cast<qreal>(13));
-                painter->drawEllipse( c, r, r );
-
-                break;
-            }
-
-            default: break;
-        }
-    }
-
-    //__________________________________________________________________
-    // https://stackoverflow.com/questions/25514812/how-to-animate-color-of-qbrush
-    QColor Button::mixColors(const QColor &cstart, const QColor &cend, qreal progress) const
-    {
-        int sh = cstart.hsvHue();
-        int eh = cend.hsvHue();
-        int ss = cstart.hsvSaturation();
-        int es = cend.hsvSaturation();
-        int sv = cstart.value();
-        int ev = cend.value();
-        int hr = qAbs( sh - eh );
-        int sr = qAbs( ss - es );
-        int vr = qAbs( sv - ev );
-        int dirh =  sh > eh ? -1 : 1;
-        int dirs =  ss > es ? -1 : 1;
-        int dirv =  sv > ev ? -1 : 1;
-
-        return QColor::fromHsv( sh + dirh * progress * hr,
-                                ss + dirs * progress * sr,
-                                sv + dirv * progress * vr );
-    }
-
-    //__________________________________________________________________
-    QColor Button::fontColor() const
-    {
-        auto d = qobject_cast<Decoration*>( decoration() );
-        QColor titleBarColor ( d->titleBarColor() );
-
-        if( !d ) {
-
-            return QColor();
-
-        } else {
-
-            return d->fontColor();
-
-        }
-
-    }
-
-    //__________________________________________________________________
-    QColor Button::foregroundColor() const
-    {
-        auto d = qobject_cast<Decoration*>( decoration() );
-        QColor titleBarColor ( d->titleBarColor() );
-
-        if( !d ) {
+        if( !d ) {
 
             return QColor();
 
@@ -3919,7 +764,7 @@ namespace Breeze
 
         } else if( m_animation->state() == QAbstractAnimation::Running ) {
 
-            return KColorUtils::mix( d->fontColor(), titleBarColor, m_opacity );
+            return ColorRamp::rgb( d->fontColor(), titleBarColor, m_opacity );
 
         } else if( this->hovered() ) {
 
@@ -3988,7 +833,7 @@ namespace Breeze
         auto d = qobject_cast<Decoration*>( decoration() );
 
         if ( d->internalSettings()->animationsEnabled() && ( !isChecked() || ( isChecked() && type() == DecorationButtonType::Maximize ) ) ) {
-          return static_cast<qreal>(7) + static_cast<qreal>(2) * m_animation->currentValue().toReal();
+          return static_cast<qreal>(7) + static_cast<qreal>(2) * m_opacity;
         }
         else
           return static_cast<qreal>(9);
@@ -4038,6 +883,17 @@ namespace Breeze
         auto d = qobject_cast<Decoration*>(decoration());
         if( d )  m_animation->setDuration( d->internalSettings()->animationsDuration() );
 
+        // symbols
+        if( d ) m_symbols = ButtonSymbols::forStyle( d->internalSettings()->buttonStyle() );
+
+    }
+
+    //__________________________________________________________________
+    void Button::updateUnisonHover()
+    {
+        // a button that is hovered itself does not change
+        auto d = qobject_cast<Decoration*>(decoration());
+        if( d && d->internalSettings()->unisonHovering() && !isHovered() ) update();
     }
 
     //__________________________________________________________________
@@ -4045,7 +901,11 @@ namespace Breeze
     {
 
         auto d = qobject_cast<Decoration*>(decoration());
-        if( !d || !d->internalSettings()->animationsEnabled() || (d->internalSettings()->buttonStyle() == 1) ) return;
+        if( !d || !d->internalSettings()->animationsEnabled() ) return;
+
+        // gnome buttons do not animate
+        const ButtonSymbols::Style* style( ButtonSymbols::style( d->internalSettings()->buttonStyle() ) );
+        if( !style || style->background == ButtonSymbols::GnomeBackground ) return;
 
         QAbstractAnimation::Direction dir = hovered ? QAbstractAnimation::Forward : QAbstractAnimation::Backward;
         if( m_animation->state() == QAbstractAnimation::Running && m_animation->direction() != dir )
@@ -23,9 +23,11 @@
 */
 #include <KDecoration2/DecorationButton>
 #include "breezedecoration.h"
+#include "breezebuttonsymbols.h"
 
 #include <QHash>
 #include <QImage>
+#include <QPixmap>
 
 #include <QVariantAnimation>
 
@@ -52,6 +54,12 @@ namespace Breeze
         //* render
         virtual void paint(QPainter *painter, const QRect &repaintRegion) override;
 
+        //* number of pre-rendered frames in a hover animation strip
+        enum { AnimationFrames = 16 };
+
+        //* release pixmaps shared by all buttons
+        static void clearPixmapCache();
+
         //* flag
         enum Flag
         {
@@ -88,6 +96,8 @@ namespace Breeze
         //@{
         void setOpacity( qreal value )
         {
+            // snap to the nearest pre-rendered frame, so that ticks in between do not repaint
+            value = qRound( value*( AnimationFrames - 1 ) )/qreal( AnimationFrames - 1 );
             if( m_opacity == value ) return;
             m_opacity = value;
             update();
@@ -96,32 +106,51 @@ namespace Breeze
         qreal opacity() const
         { return m_opacity; }
 
+        //* true while the hover animation is running
+        bool isAnimating() const
+        { return m_animation->state() == QAbstractAnimation::Running; }
+
         //@}
 
-        private Q_SLOTS:
+        public Q_SLOTS:
 
         //* apply configuration changes
         void reconfigure();
 
+        private Q_SLOTS:
+
         //* animation state
         void updateAnimationState(bool);
 
+        //* repaint on group hover changes, when buttons hover in unison
+        void updateUnisonHover();
+
         private:
 
         //* private constructor
         explicit Button(KDecoration2::DecorationButtonType type, Decoration *decoration, QObject *parent = nullptr);
 
-        //* draw button icon
-        void drawIconPlasma( QPainter *) const;
-        void drawIconGnome( QPainter *) const;
-        void drawIconMacSierra( QPainter *) const;
-        void drawIconMacDarkAurorae( QPainter *) const;
-        void drawIconSBEsierra( QPainter *) const;
-        void drawIconSBEdarkAurorae( QPainter *) const;
-        void drawIconSierraColorSymbols( QPainter *) const;
-        void drawIconDarkAuroraeColorSymbols( QPainter *) const;
-        void drawIconSierraMonochromeSymbols( QPainter *) const;
-        void drawIconDarkAuroraeMonochromeSymbols( QPainter *) const;
+        //* application icon for the menu button, colorized with the font color and cached
+        QPixmap menuIconPixmap( const QSize&, qreal devicePixelRatio ) const;
+
+        //* drop cached pixmaps of the previous application icon
+        void discardMenuIcon();
+
+        //* button icon, taken from the shared pixmap cache or rendered on demand
+        QPixmap iconPixmap( qreal devicePixelRatio ) const;
+
+        //* draw button icon for the current button style
+        void drawIcon( QPainter *) const;
+
+        //* compiled symbols for the current button style, if it is data driven
+        const ButtonSymbols* symbols() const;
+
+        //*@name draw button icon, per background model
+        //@{
+        void drawPlasmaIcon( QPainter*, const ButtonSymbols::Style&, qreal penScale ) const;
+        void drawGnomeIcon( QPainter*, const ButtonSymbols::Style&, qreal penScale ) const;
+        void drawCircleIcon( QPainter*, const ButtonSymbols::Style&, qreal penScale ) const;
+        //@}
 
         //*@name colors
         //@{
@@ -155,6 +184,12 @@ namespace Breeze
 
         //* active state change opacity
         qreal m_opacity = 0;
+
+        //* cache key of the last application icon painted by the menu button
+        mutable qint64 m_menuIconKey = 0;
+
+        //* symbols compiled for the button style, updated on reconfigure
+        const ButtonSymbols* m_symbols = nullptr;
     };
 
 } // namespace
@@ -0,0 +1,574 @@
+/*
+* Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This program is free software; you can redistribute it and/or
+* modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation; either version 2 of
+* the License or (at your option) version 3 or any later version
+* accepted by the membership of KDE e.V. (or its successor approved
+* by the membership of KDE e.V.), which shall act as a proxy
+* defined in Section 14 of version 3 of the license.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "breezebuttonsymbols.h"
+#include "breeze.h"
+
+#include <QPainter>
+#include <QPainterPath>
+
+namespace Breeze
+{
+
+    using KDecoration2::DecorationButtonType;
+
+    namespace
+    {
+
+        //* button styles, in configuration order
+        const ButtonSymbols::Style s_styles[] =
+        {
+            // plasma and gnome
+            { ButtonSymbols::Plasma, ButtonSymbols::PlasmaBackground, PenWidth::Symbol, ButtonSymbols::FollowWindow, 0 },
+            { ButtonSymbols::Gnome, ButtonSymbols::GnomeBackground, PenWidth::Symbol, ButtonSymbols::FollowWindow, 0 },
+
+            // mac
+            { ButtonSymbols::Sierra, ButtonSymbols::TrafficLight, 1.7, ButtonSymbols::FollowWindow, ButtonSymbols::ShrinkWithoutAnimations },
+            { ButtonSymbols::DarkAurorae, ButtonSymbols::TrafficLight, 1.2, ButtonSymbols::FollowWindow, ButtonSymbols::ShrinkWithoutAnimations|ButtonSymbols::AlternateWhileAnimating },
+
+            // sbe sierra
+            { ButtonSymbols::Sierra, ButtonSymbols::Outline, 1.7, ButtonSymbols::FollowWindow, ButtonSymbols::ShrinkWithoutAnimations },
+            { ButtonSymbols::Sierra, ButtonSymbols::Outline, 1.7, ButtonSymbols::AlwaysActive, ButtonSymbols::ShrinkWithoutAnimations },
+            { ButtonSymbols::Sierra, ButtonSymbols::Outline, 1.7, ButtonSymbols::AlwaysInactive, ButtonSymbols::ShrinkWithoutAnimations },
+
+            // sbe dark aurorae
+            { ButtonSymbols::DarkAurorae, ButtonSymbols::Outline, 1.2, ButtonSymbols::FollowWindow, ButtonSymbols::ShrinkWithoutAnimations|ButtonSymbols::AlternateWhileAnimating },
+            { ButtonSymbols::DarkAurorae, ButtonSymbols::Outline, 1.2, ButtonSymbols::AlwaysActive, ButtonSymbols::ShrinkWithoutAnimations|ButtonSymbols::AlternateWhileAnimating },
+            { ButtonSymbols::DarkAurorae, ButtonSymbols::Outline, 1.2, ButtonSymbols::AlwaysInactive, ButtonSymbols::ShrinkWithoutAnimations|ButtonSymbols::AlternateWhileAnimating },
+
+            // color symbols
+            { ButtonSymbols::Sierra, ButtonSymbols::Tinted, 1.7, ButtonSymbols::FollowWindow, ButtonSymbols::ThinUncheckedShade },
+            { ButtonSymbols::DarkAurorae, ButtonSymbols::Tinted, 1.2, ButtonSymbols::FollowWindow, 0 },
+
+            // monochrome symbols
+            { ButtonSymbols::Sierra, ButtonSymbols::Monochrome, 1.7, ButtonSymbols::FollowWindow, ButtonSymbols::HoverRadius },
+            { ButtonSymbols::DarkAurorae, ButtonSymbols::Monochrome, 1.2, ButtonSymbols::FollowWindow, 0 }
+        };
+
+    }
+
+    //__________________________________________________________________
+    const ButtonSymbols::Style* ButtonSymbols::style( int style )
+    {
+        if( style < 0 || style >= int( sizeof( s_styles )/sizeof( s_styles[0] ) ) ) return nullptr;
+        else return &s_styles[style];
+    }
+
+    //__________________________________________________________________
+    const ButtonSymbols::TypeStyle& ButtonSymbols::typeStyle( DecorationButtonType type )
+    {
+        static const TypeStyle close = { qRgb( 238, 102, 90 ), qRgb( 255, 94, 88 ), 0 };
+        static const TypeStyle maximize = { qRgb( 100, 196, 86 ), qRgb( 40, 200, 64 ), 0 };
+        static const TypeStyle minimize = { qRgb( 223, 192, 76 ), qRgb( 255, 188, 48 ), 0 };
+        static const TypeStyle onAllDesktops = { qRgb( 125, 209, 200 ), qRgb( 125, 209, 200 ), ShownWhenChecked|KeepsColorWhenChecked };
+        static const TypeStyle shade = { qRgb( 204, 176, 213 ), qRgb( 204, 176, 213 ), ShownWhenChecked|KeepsColorWhenChecked };
+        static const TypeStyle keepBelow = { qRgb( 255, 137, 241 ), qRgb( 255, 137, 241 ), ShownWhenChecked|KeepsColorWhenChecked };
+        static const TypeStyle keepAbove = { qRgb( 135, 206, 249 ), qRgb( 135, 206, 249 ), ShownWhenChecked|KeepsColorWhenChecked };
+        static const TypeStyle contextHelp = { qRgb( 102, 156, 246 ), qRgb( 102, 156, 246 ), ShownWhenChecked };
+        static const TypeStyle other = { 0, 0, 0 };
+
+        switch( type )
+        {
+            case DecorationButtonType::Close: return close;
+            case DecorationButtonType::Maximize: return maximize;
+            case DecorationButtonType::Minimize: return minimize;
+            case DecorationButtonType::OnAllDesktops: return onAllDesktops;
+            case DecorationButtonType::Shade: return shade;
+            case DecorationButtonType::KeepBelow: return keepBelow;
+            case DecorationButtonType::KeepAbove: return keepAbove;
+            case DecorationButtonType::ContextHelp: return contextHelp;
+            default: return other;
+        }
+    }
+
+    //__________________________________________________________________
+    ButtonSymbols::Family ButtonSymbols::family( int style )
+    {
+        const Style* description( ButtonSymbols::style( style ) );
+        return description ? description->family : NoFamily;
+    }
+
+    //__________________________________________________________________
+    const ButtonSymbols* ButtonSymbols::forStyle( int style )
+    {
+        // each family is compiled the first time it is requested
+        switch( family( style ) )
+        {
+            case Plasma:
+            {
+                static const ButtonSymbols plasma( Plasma );
+                return &plasma;
+            }
+
+            case Gnome:
+            {
+                static const ButtonSymbols gnome( Gnome );
+                return &gnome;
+            }
+
+            case Sierra:
+            {
+                static const ButtonSymbols sierra( Sierra );
+                return &sierra;
+            }
+
+            case DarkAurorae:
+            {
+                static const ButtonSymbols darkAurorae( DarkAurorae );
+                return &darkAurorae;
+            }
+
+            default: return nullptr;
+        }
+    }
+
+    //__________________________________________________________________
+    ButtonSymbols::ButtonSymbols( Family family ):
+        m_family( family ),
+        m_ranges( 4*( int( DecorationButtonType::Custom ) + 1 ) )
+    {
+        switch( family )
+        {
+            case Plasma: compilePlasma(); break;
+            case Gnome: compileGnome(); break;
+            case Sierra: compileSierra(); break;
+            case DarkAurorae: compileDarkAurorae(); break;
+            default: break;
+        }
+
+        m_primitives.squeeze();
+        m_points.squeeze();
+        m_paths.squeeze();
+    }
+
+    //__________________________________________________________________
+    void ButtonSymbols::paint( QPainter* painter, DecorationButtonType type, bool checked,
+        const QPen& pen, const QColor& foreground, const QColor& background, const QColor& detail, bool alternate ) const
+    {
+
+        int index( ButtonSymbols::index( type, checked, alternate ) );
+        if( index < 0 ) return;
+        if( alternate && !m_ranges[index].count ) index = ButtonSymbols::index( type, checked, false );
+
+        const QColor colors[ColorRoleCount] = { QColor(), foreground, background, detail.isValid() ? detail : foreground };
+
+        QPen strokePen( pen );
+
+        const Range& range( m_ranges[index] );
+        const Primitive* primitive( m_primitives.constData() + range.first );
+        const Primitive* end( primitive + range.count );
+        for( ; primitive != end; ++primitive )
+        {
+
+            const QColor& strokeColor( colors[primitive->stroke] );
+            const QColor& fillColor( colors[primitive->fill] );
+            if( !strokeColor.isValid() && !fillColor.isValid() ) continue;
+
+            if( strokeColor.isValid() )
+            {
+                strokePen.setColor( strokeColor );
+                strokePen.setJoinStyle( ( primitive->flags & RoundJoin ) ? Qt::RoundJoin : pen.joinStyle() );
+                painter->setPen( strokePen );
+            } else painter->setPen( Qt::NoPen );
+
+            if( fillColor.isValid() ) painter->setBrush( fillColor );
+            else painter->setBrush( Qt::NoBrush );
+
+            if( primitive->opcode == DrawPath )
+            {
+                painter->drawPath( m_paths[primitive->offset] );
+                continue;
+            }
+
+            const QPointF* points( m_points.constData() + primitive->offset );
+            switch( primitive->opcode )
+            {
+                case Line: painter->drawLine( points[0], points[1] ); break;
+                case Polyline: painter->drawPolyline( points, primitive->count ); break;
+                case Polygon: painter->drawPolygon( points, primitive->count ); break;
+                case Rect: painter->drawRect( QRectF( points[0], QSizeF( points[1].x(), points[1].y() ) ) ); break;
+                case Ellipse: painter->drawEllipse( points[0], points[1].x(), points[1].y() ); break;
+                case Point: painter->drawPoint( points[0] ); break;
+                case Arc: painter->drawArc( QRectF( points[0], QSizeF( points[1].x(), points[1].y() ) ), qRound( 16*points[2].x() ), qRound( 16*points[2].y() ) ); break;
+
+                default: break;
+            }
+
+        }
+
+    }
+
+    //__________________________________________________________________
+    int ButtonSymbols::index( DecorationButtonType type, bool checked, bool alternate )
+    {
+        const int value( int( type ) );
+        if( value < 0 || value > int( DecorationButtonType::Custom ) ) return -1;
+        return 4*value + ( checked ? 1:0 ) + ( alternate ? 2:0 );
+    }
+
+    //__________________________________________________________________
+    void ButtonSymbols::begin( DecorationButtonType type, bool checked, bool alternate )
+    {
+        m_current = index( type, checked, alternate );
+        m_ranges[m_current].first = m_primitives.size();
+        m_ranges[m_current].count = 0;
+        setColorRoles( Foreground, NoColor );
+    }
+
+    //__________________________________________________________________
+    void ButtonSymbols::setColorRoles( ColorRole stroke, ColorRole fill, quint8 flags )
+    {
+        m_stroke = stroke;
+        m_fill = fill;
+        m_flags = flags;
+    }
+
+    //__________________________________________________________________
+    void ButtonSymbols::add( Opcode opcode, const QVector<QPointF>& points )
+    {
+        // paths are built here, once, and only drawn at paint time
+        switch( opcode )
+        {
+            case MoveTo: m_path.moveTo( points[0] ); return;
+            case LineTo: m_path.lineTo( points[0] ); return;
+            case ArcTo: m_path.arcTo( QRectF( points[0], QSizeF( points[1].x(), points[1].y() ) ), points[2].x(), points[2].y() ); return;
+            case CubicTo: m_path.cubicTo( points[0], points[1], points[2] ); return;
+
+            case DrawPath:
+            {
+                const Primitive primitive = { quint8( opcode ), m_stroke, m_fill, m_flags, quint16( m_paths.size() ), 0 };
+                m_primitives.append( primitive );
+                m_paths.append( m_path );
+                m_path = QPainterPath();
+                ++m_ranges[m_current].count;
+                return;
+            }
+
+            default: break;
+        }
+
+        const Primitive primitive = { quint8( opcode ), m_stroke, m_fill, m_flags, quint16( m_points.size() ), quint16( points.size() ) };
+        m_primitives.append( primitive );
+        m_points += points;
+        ++m_ranges[m_current].count;
+    }
+
+    //__________________________________________________________________
+    void ButtonSymbols::compilePlasma()
+    {
+
+        // close
+        begin( DecorationButtonType::Close, false );
+        add( Line, { QPointF( 5, 5 ), QPointF( 13, 13 ) } );
+        add( Line, { QPointF( 13, 5 ), QPointF( 5, 13 ) } );
+
+        // maximize
+        begin( DecorationButtonType::Maximize, false );
+        add( Polyline, { QPointF( 4, 11 ), QPointF( 9, 6 ), QPointF( 14, 11 ) } );
+
+        begin( DecorationButtonType::Maximize, true );
+        setColorRoles( Foreground, NoColor, RoundJoin );
+        add( Polygon, { QPointF( 4, 9 ), QPointF( 9, 4 ), QPointF( 14, 9 ), QPointF( 9, 14 ) } );
+
+        // minimize
+        begin( DecorationButtonType::Minimize, false );
+        add( Polyline, { QPointF( 4, 7 ), QPointF( 9, 12 ), QPointF( 14, 7 ) } );
+
+        // on all desktops
+        begin( DecorationButtonType::OnAllDesktops, false );
+        setColorRoles( NoColor, Foreground );
+        add( Polygon, { QPointF( 6.5, 8.5 ), QPointF( 12, 3 ), QPointF( 15, 6 ), QPointF( 9.5, 11.5 ) } );
+        setColorRoles( Foreground, NoColor );
+        add( Line, { QPointF( 5.5, 7.5 ), QPointF( 10.5, 12.5 ) } );
+        add( Line, { QPointF( 12, 6 ), QPointF( 4.5, 13.5 ) } );
+
+        // outer ring and center dot
+        begin( DecorationButtonType::OnAllDesktops, true );
+        setColorRoles( NoColor, Foreground );
+        add( Ellipse, { QPointF( 9, 9 ), QPointF( 6, 6 ) } );
+        setColorRoles( NoColor, Background );
+        add( Ellipse, { QPointF( 9, 9 ), QPointF( 1, 1 ) } );
+
+        // shade
+        for( const bool checked : { false, true } )
+        {
+            begin( DecorationButtonType::Shade, checked );
+            add( Line, { QPointF( 4, 5.5 ), QPointF( 14, 5.5 ) } );
+            if( checked ) add( Polyline, { QPointF( 4, 8 ), QPointF( 9, 13 ), QPointF( 14, 8 ) } );
+            else add( Polyline, { QPointF( 4, 13 ), QPointF( 9, 8 ), QPointF( 14, 13 ) } );
+        }
+
+        // keep below and keep above do not depend on state
+        for( const bool checked : { false, true } )
+        {
+            begin( DecorationButtonType::KeepBelow, checked );
+            add( Polyline, { QPointF( 4, 5 ), QPointF( 9, 10 ), QPointF( 14, 5 ) } );
+            add( Polyline, { QPointF( 4, 9 ), QPointF( 9, 14 ), QPointF( 14, 9 ) } );
+
+            begin( DecorationButtonType::KeepAbove, checked );
+            add( Polyline, { QPointF( 4, 9 ), QPointF( 9, 4 ), QPointF( 14, 9 ) } );
+            add( Polyline, { QPointF( 4, 13 ), QPointF( 9, 8 ), QPointF( 14, 13 ) } );
+        }
+
+        // application menu
+        begin( DecorationButtonType::ApplicationMenu, false );
+        add( Rect, { QPointF( 3.5, 4.5 ), QPointF( 11, 1 ) } );
+        add( Rect, { QPointF( 3.5, 8.5 ), QPointF( 11, 1 ) } );
+        add( Rect, { QPointF( 3.5, 12.5 ), QPointF( 11, 1 ) } );
+
+        // context help
+        begin( DecorationButtonType::ContextHelp, false );
+        add( MoveTo, { QPointF( 5, 6 ) } );
+        add( ArcTo, { QPointF( 5, 3.5 ), QPointF( 8, 5 ), QPointF( 180, -180 ) } );
+        add( CubicTo, { QPointF( 12.5, 9.5 ), QPointF( 9, 7.5 ), QPointF( 9, 11.5 ) } );
+        add( DrawPath, {} );
+        add( Rect, { QPointF( 9, 15 ), QPointF( 0.5, 0.5 ) } );
+
+    }
+
+    //__________________________________________________________________
+    void ButtonSymbols::compileGnome()
+    {
+
+        // close
+        begin( DecorationButtonType::Close, false );
+        add( Line, { QPointF( 6.5, 6.5 ), QPointF( 11.5, 11.5 ) } );
+        add( Line, { QPointF( 11.5, 6.5 ), QPointF( 6.5, 11.5 ) } );
+
+        // maximize
+        begin( DecorationButtonType::Maximize, false );
+        add( Rect, { QPointF( 6.5, 6.5 ), QPointF( 5, 5 ) } );
+
+        begin( DecorationButtonType::Maximize, true );
+        add( Rect, { QPointF( 7.5, 7.5 ), QPointF( 3, 3 ) } );
+
+        // minimize
+        begin( DecorationButtonType::Minimize, false );
+        add( Line, { QPointF( 6.5, 11.5 ), QPointF( 11.5, 11.5 ) } );
+
+        // on all desktops
+        begin( DecorationButtonType::OnAllDesktops, false );
+        setColorRoles( NoColor, Foreground );
+        add( Ellipse, { QPointF( 9, 9 ), QPointF( 2, 2 ) } );
+
+        begin( DecorationButtonType::OnAllDesktops, true );
+        setColorRoles( NoColor, Foreground );
+        add( Ellipse, { QPointF( 9, 9 ), QPointF( 1, 1 ) } );
+
+        // shade
+        // the lines were drawn with QPainter::drawLine( int, int, int, int ),
+        // which truncated their 7.5 and 12.5 ordinates. Kept as rendered
+        begin( DecorationButtonType::Shade, false );
+        add( Line, { QPointF( 6, 7 ), QPointF( 12, 7 ) } );
+        setColorRoles( NoColor, Foreground );
+        add( Polygon, { QPointF( 9, 7.5 ), QPointF( 5, 12.5 ), QPointF( 13, 12.5 ) } );
+
+        begin( DecorationButtonType::Shade, true );
+        add( Line, { QPointF( 6, 12 ), QPointF( 12, 12 ) } );
+        setColorRoles( NoColor, Foreground );
+        add( Polygon, { QPointF( 9, 12.5 ), QPointF( 5, 6.5 ), QPointF( 13, 6.5 ) } );
+
+        // keep below and keep above do not depend on state
+        for( const bool checked : { false, true } )
+        {
+            begin( DecorationButtonType::KeepBelow, checked );
+            setColorRoles( NoColor, Foreground );
+            add( Polygon, { QPointF( 9, 11.5 ), QPointF( 5, 6.5 ), QPointF( 13, 6.5 ) } );
+
+            begin( DecorationButtonType::KeepAbove, checked );
+            setColorRoles( NoColor, Foreground );
+            add( Polygon, { QPointF( 9, 6.5 ), QPointF( 5, 11.5 ), QPointF( 13, 11.5 ) } );
+        }
+
+        // application menu
+        begin( DecorationButtonType::ApplicationMenu, false );
+        add( Line, { QPointF( 6.5, 6.5 ), QPointF( 11.5, 6.5 ) } );
+        add( Line, { QPointF( 6.5, 9 ), QPointF( 11.5, 9 ) } );
+        add( Line, { QPointF( 6.5, 11.5 ), QPointF( 11.5, 11.5 ) } );
+
+        // context help
+        begin( DecorationButtonType::ContextHelp, false );
+        add( Arc, { QPointF( 7, 5.5 ), QPointF( 4, 4 ), QPointF( 260, 280 ) } );
+        setColorRoles( Foreground, Foreground );
+        add( Ellipse, { QPointF( 9, 12 ), QPointF( 0.5, 0.5 ) } );
+
+    }
+
+    //__________________________________________________________________
+    void ButtonSymbols::compileSierra()
+    {
+
+        // symbols that do not depend on state
+        for( const bool checked : { false, true } )
+        {
+            // close
+            begin( DecorationButtonType::Close, checked );
+            add( Line, { QPointF( 6, 6 ), QPointF( 12, 12 ) } );
+            add( Line, { QPointF( 6, 12 ), QPointF( 12, 6 ) } );
+
+            // minimize
+            begin( DecorationButtonType::Minimize, checked );
+            add( Line, { QPointF( 5, 9 ), QPointF( 13, 9 ) } );
+
+            // on all desktops
+            begin( DecorationButtonType::OnAllDesktops, checked );
+            setColorRoles( NoColor, Foreground );
+            add( Ellipse, { QPointF( 9, 9 ), QPointF( 3, 3 ) } );
+
+            // keep below and keep above
+            begin( DecorationButtonType::KeepBelow, checked );
+            setColorRoles( NoColor, Foreground );
+            add( Polygon, { QPointF( 9, 12 ), QPointF( 5, 6 ), QPointF( 13, 6 ) } );
+
+            begin( DecorationButtonType::KeepAbove, checked );
+            setColorRoles( NoColor, Foreground );
+            add( Polygon, { QPointF( 9, 6 ), QPointF( 5, 12 ), QPointF( 13, 12 ) } );
+
+            // application menu
+            begin( DecorationButtonType::ApplicationMenu, checked );
+            add( Line, { QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) } );
+            add( Line, { QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) } );
+            add( Line, { QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) } );
+
+            // context help
+            begin( DecorationButtonType::ContextHelp, checked );
+            add( MoveTo, { QPointF( 6, 6 ) } );
+            add( ArcTo, { QPointF( 5.5, 4 ), QPointF( 7.5, 4.5 ), QPointF( 180, -180 ) } );
+            add( CubicTo, { QPointF( 11, 9 ), QPointF( 9, 6 ), QPointF( 9, 10 ) } );
+            add( DrawPath, {} );
+            add( Point, { QPointF( 9, 13 ) } );
+        }
+
+        // maximize, two triangles
+        begin( DecorationButtonType::Maximize, false );
+        setColorRoles( NoColor, Foreground );
+        add( Polygon, { QPointF( 5, 13 ), QPointF( 11, 13 ), QPointF( 5, 7 ) } );
+        add( Polygon, { QPointF( 13, 5 ), QPointF( 7, 5 ), QPointF( 13, 11 ) } );
+
+        begin( DecorationButtonType::Maximize, true );
+        setColorRoles( NoColor, Foreground );
+        add( Polygon, { QPointF( 8.5, 9.5 ), QPointF( 2.5, 9.5 ), QPointF( 8.5, 15.5 ) } );
+        add( Polygon, { QPointF( 9.5, 8.5 ), QPointF( 15.5, 8.5 ), QPointF( 9.5, 2.5 ) } );
+
+        // shade
+        begin( DecorationButtonType::Shade, false );
+        add( Line, { QPointF( 6, 6 ), QPointF( 12, 6 ) } );
+        setColorRoles( NoColor, Foreground );
+        add( Polygon, { QPointF( 9, 7 ), QPointF( 5, 12 ), QPointF( 13, 12 ) } );
+
+        begin( DecorationButtonType::Shade, true );
+        add( Line, { QPointF( 6, 12 ), QPointF( 12, 12 ) } );
+        setColorRoles( NoColor, Foreground );
+        add( Polygon, { QPointF( 9, 11 ), QPointF( 5, 6 ), QPointF( 13, 6 ) } );
+
+    }
+
+    //__________________________________________________________________
+    void ButtonSymbols::compileDarkAurorae()
+    {
+
+        // symbols that do not depend on state
+        for( const bool checked : { false, true } )
+        {
+            // close
+            begin( DecorationButtonType::Close, checked );
+            add( Line, { QPointF( 5, 5 ), QPointF( 13, 13 ) } );
+            add( Line, { QPointF( 5, 13 ), QPointF( 13, 5 ) } );
+
+            // minimize
+            begin( DecorationButtonType::Minimize, checked );
+            add( Line, { QPointF( 5, 9 ), QPointF( 13, 9 ) } );
+
+            // keep below and keep above
+            begin( DecorationButtonType::KeepBelow, checked );
+            add( Polyline, { QPointF( 4, 7 ), QPointF( 9, 12 ), QPointF( 14, 7 ) } );
+
+            begin( DecorationButtonType::KeepAbove, checked );
+            add( Polyline, { QPointF( 4, 11 ), QPointF( 9, 6 ), QPointF( 14, 11 ) } );
+
+            // application menu
+            begin( DecorationButtonType::ApplicationMenu, checked );
+            add( Line, { QPointF( 3.5, 5 ), QPointF( 14.5, 5 ) } );
+            add( Line, { QPointF( 3.5, 9 ), QPointF( 14.5, 9 ) } );
+            add( Line, { QPointF( 3.5, 13 ), QPointF( 14.5, 13 ) } );
+
+            // context help
+            begin( DecorationButtonType::ContextHelp, checked );
+            add( Arc, { QPointF( 6, 4 ), QPointF( 6, 6 ), QPointF( 260, 280 ) } );
+            setColorRoles( Foreground, Detail );
+            add( Ellipse, { QPointF( 9, 13 ), QPointF( 1, 1 ) } );
+        }
+
+        // maximize, open vs. solid rectangle
+        begin( DecorationButtonType::Maximize, false );
+        add( Line, { QPointF( 4.5, 4.5 ), QPointF( 13.5, 4.5 ) } );
+        add( Line, { QPointF( 13.5, 4.5 ), QPointF( 13.5, 9 ) } );
+        add( Line, { QPointF( 4.5, 9 ), QPointF( 4.5, 13.5 ) } );
+        add( Line, { QPointF( 4.5, 13.5 ), QPointF( 13.5, 13.5 ) } );
+
+        begin( DecorationButtonType::Maximize, true );
+        add( Line, { QPointF( 4.5, 6 ), QPointF( 13.5, 6 ) } );
+        add( Line, { QPointF( 13.5, 6 ), QPointF( 13.5, 12 ) } );
+        add( Line, { QPointF( 4.5, 6 ), QPointF( 4.5, 12 ) } );
+        add( Line, { QPointF( 4.5, 12 ), QPointF( 13.5, 12 ) } );
+
+        // on all desktops, a window spread over several desktops
+        begin( DecorationButtonType::OnAllDesktops, false );
+        add( Line, { QPointF( 7, 5 ), QPointF( 15, 5 ) } );
+        add( Line, { QPointF( 15, 5 ), QPointF( 15, 13 ) } );
+        add( Line, { QPointF( 7, 5 ), QPointF( 7, 13 ) } );
+        add( Line, { QPointF( 7, 13 ), QPointF( 15, 13 ) } );
+        add( Line, { QPointF( 3, 5 ), QPointF( 3, 13 ) } );
+        add( Line, { QPointF( 3, 5 ), QPointF( 4.5, 5 ) } );
+        add( Line, { QPointF( 3, 13 ), QPointF( 4.5, 13 ) } );
+
+        // single window, while the hover animation runs
+        begin( DecorationButtonType::OnAllDesktops, false, true );
+        add( Line, { QPointF( 5, 5 ), QPointF( 13, 5 ) } );
+        add( Line, { QPointF( 13, 5 ), QPointF( 13, 13 ) } );
+        add( Line, { QPointF( 5, 5 ), QPointF( 5, 13 ) } );
+        add( Line, { QPointF( 5, 13 ), QPointF( 13, 13 ) } );
+        setColorRoles( Foreground, Foreground );
+        add( Ellipse, { QPointF( 9, 9 ), QPointF( 0.5, 0.5 ) } );
+
+        // two stacked windows
+        begin( DecorationButtonType::OnAllDesktops, true );
+        add( Line, { QPointF( 5, 5 ), QPointF( 11, 5 ) } );
+        add( Line, { QPointF( 11, 5 ), QPointF( 11, 11 ) } );
+        add( Line, { QPointF( 5, 5 ), QPointF( 5, 11 ) } );
+        add( Line, { QPointF( 5, 11 ), QPointF( 11, 11 ) } );
+        add( Line, { QPointF( 7, 7 ), QPointF( 13, 7 ) } );
+        add( Line, { QPointF( 13, 7 ), QPointF( 13, 13 ) } );
+        add( Line, { QPointF( 7, 7 ), QPointF( 7, 13 ) } );
+        add( Line, { QPointF( 7, 13 ), QPointF( 13, 13 ) } );
+
+        // shade
+        begin( DecorationButtonType::Shade, false );
+        add( Line, { QPointF( 4, 6 ), QPointF( 14, 6 ) } );
+        setColorRoles( Foreground, Foreground );
+        add( Ellipse, { QPointF( 9, 11 ), QPointF( 1, 1 ) } );
+
+        begin( DecorationButtonType::Shade, true );
+        add( Line, { QPointF( 4, 12 ), QPointF( 14, 12 ) } );
+        setColorRoles( Foreground, Detail );
+        add( Ellipse, { QPointF( 9, 7 ), QPointF( 1, 1 ) } );
+
+    }
+
+}
@@ -0,0 +1,254 @@
+#ifndef BREEZE_BUTTONSYMBOLS_H
+#define BREEZE_BUTTONSYMBOLS_H
+
+/*
+* Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This program is free software; you can redistribute it and/or
+* modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation; either version 2 of
+* the License or (at your option) version 3 or any later version
+* accepted by the membership of KDE e.V. (or its successor approved
+* by the membership of KDE e.V.), which shall act as a proxy
+* defined in Section 14 of version 3 of the license.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <KDecoration2/DecorationButton>
+
+#include <QColor>
+#include <QPainterPath>
+#include <QPen>
+#include <QPointF>
+#include <QVector>
+
+class QPainter;
+
+namespace Breeze
+{
+
+    //* button symbols of one family of button styles, compiled into a flat display list
+    /**
+    coordinates are expressed in the button's QRect( 0, 0, 18, 18 ) symbol space.
+    All primitives of a family share one point array, and each
+    (button type, checked state, alternate) triplet maps to a contiguous range of primitives.
+    Curved symbols are built into painter paths once, when the family is compiled, and shared
+    by all buttons.
+    Button styles combine a symbol family with one of the background models below,
+    so that a new style is a new row in the style table
+    */
+    class ButtonSymbols
+    {
+        public:
+
+        //* color roles, resolved by the caller at paint time
+        enum ColorRole
+        {
+            NoColor,
+            Foreground,
+            Background,
+            Detail,     // small filled details, in the unmixed symbol color. Falls back to foreground
+            ColorRoleCount
+        };
+
+        //* primitives
+        enum Opcode
+        {
+            Line,       // p1, p2
+            Polyline,   // points
+            Polygon,    // points
+            Rect,       // top left, size
+            Ellipse,    // center, radii
+            Point,      // point
+            Arc,        // top left, size, ( start, span ) in degrees
+            MoveTo,     // point, compiled into the current path
+            LineTo,     // point, compiled into the current path
+            ArcTo,      // top left, size, ( start, sweep ) in degrees, compiled into the current path
+            CubicTo,    // control point 1, control point 2, end point, compiled into the current path
+            DrawPath    // draw the path built so far, from the path cache
+        };
+
+        //* primitive flags
+        enum Flag
+        {
+            RoundJoin = 1<<0
+        };
+
+        //* symbol families
+        enum Family
+        {
+            Plasma,
+            Gnome,
+            Sierra,
+            DarkAurorae,
+            NoFamily
+        };
+
+        //* button backgrounds
+        enum Background
+        {
+            //* circle colored from the button state, breeze like
+            PlasmaBackground,
+
+            //* rounded rectangle with a vertical gradient, while hovered or checked
+            GnomeBackground,
+
+            //* circle colored per button type, grey for inactive windows. Symbols are shown on hover
+            TrafficLight,
+
+            //* circle colored per button type, outlined or hidden for inactive windows. Symbols are shown on hover
+            Outline,
+
+            //* circle colored per button type, fading in on hover
+            Tinted,
+
+            //* circle in the symbol color, fading in on hover
+            Monochrome
+        };
+
+        //* when buttons get the inactive window look
+        enum InactiveLook
+        {
+            FollowWindow,
+            AlwaysActive,
+            AlwaysInactive
+        };
+
+        //* style flags
+        enum StyleFlag
+        {
+            //* background and symbol shrink to 7/9 when animations are disabled
+            ShrinkWithoutAnimations = 1<<0,
+
+            //* circle radius only follows hover, and fills the button when checked
+            HoverRadius = 1<<1,
+
+            //* alternate symbols are shown while the hover animation runs
+            AlternateWhileAnimating = 1<<2,
+
+            //* unchecked shade symbol is drawn with a thin pen
+            ThinUncheckedShade = 1<<3
+        };
+
+        //* button style, as selected in the configuration
+        struct Style
+        {
+            Family family;
+            Background background;
+            qreal penWidth;
+            InactiveLook inactiveLook;
+            quint8 flags;
+        };
+
+        //* button style for a given configuration index, or nullptr if the style is unknown
+        static const Style* style( int );
+
+        //* button type flags
+        enum TypeFlag
+        {
+            //* symbol is shown while checked, not only on hover
+            ShownWhenChecked = 1<<0,
+
+            //* button keeps its full color while checked
+            KeepsColorWhenChecked = 1<<1
+        };
+
+        //* button type colors, over dark and light title bars, and flags
+        struct TypeStyle
+        {
+            QRgb darkTitleBarColor;
+            QRgb lightTitleBarColor;
+            quint8 flags;
+        };
+
+        //* colors and flags of a given button type
+        static const TypeStyle& typeStyle( KDecoration2::DecorationButtonType );
+
+        //* symbol family used by a given button style
+        static Family family( int style );
+
+        //* compiled symbols for a given button style, or nullptr if the style is unknown
+        static const ButtonSymbols* forStyle( int style );
+
+        //* symbol family
+        Family family() const
+        { return m_family; }
+
+        //* replay the symbol of a given button type and state
+        /**
+        alternate selects the symbol some styles show while the hover animation runs,
+        and falls back to the regular symbol when there is none
+        */
+        void paint( QPainter*, KDecoration2::DecorationButtonType, bool checked,
+            const QPen&, const QColor& foreground, const QColor& background = QColor(),
+            const QColor& detail = QColor(), bool alternate = false ) const;
+
+        private:
+
+        //* constructor
+        explicit ButtonSymbols( Family );
+
+        //*@name compilation
+        //@{
+        void compilePlasma();
+        void compileGnome();
+        void compileSierra();
+        void compileDarkAurorae();
+
+        void begin( KDecoration2::DecorationButtonType, bool checked, bool alternate = false );
+        void setColorRoles( ColorRole stroke, ColorRole fill, quint8 flags = 0 );
+        void add( Opcode, const QVector<QPointF>& );
+        //@}
+
+        //* index of a (type, checked, alternate) triplet in the range table, or -1
+        static int index( KDecoration2::DecorationButtonType, bool checked, bool alternate );
+
+        //* one primitive
+        struct Primitive
+        {
+            quint8 opcode;
+            quint8 stroke;
+            quint8 fill;
+            quint8 flags;
+            quint16 offset;
+            quint16 count;
+        };
+
+        //* primitives used by a (type, checked, alternate) triplet
+        struct Range
+        {
+            quint16 first = 0;
+            quint16 count = 0;
+        };
+
+        Family m_family;
+
+        //*@name current compilation state
+        //@{
+        int m_current = -1;
+        quint8 m_stroke = Foreground;
+        quint8 m_fill = NoColor;
+        quint8 m_flags = 0;
+        //@}
+
+        //* path being compiled
+        QPainterPath m_path;
+
+        QVector<Primitive> m_primitives;
+        QVector<QPointF> m_points;
+        QVector<Range> m_ranges;
+
+        //* compiled paths, indexed by DrawPath primitives
+        QVector<QPainterPath> m_paths;
+
+    };
+
+} // namespace
+
+#endif
@@ -0,0 +1,131 @@
+/*
+* Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This program is free software; you can redistribute it and/or
+* modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation; either version 2 of
+* the License or (at your option) version 3 or any later version
+* accepted by the membership of KDE e.V. (or its successor approved
+* by the membership of KDE e.V.), which shall act as a proxy
+* defined in Section 14 of version 3 of the license.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "breezecolorramp.h"
+
+#include <KColorUtils>
+
+#include <QHash>
+
+namespace Breeze
+{
+
+    namespace
+    {
+
+        //* shared ramps of one mode, direct mapped from their end points
+        class SharedRamps
+        {
+            public:
+
+            //* number of ramps
+            enum { Size = 64 };
+
+            //* constructor
+            explicit SharedRamps( ColorRamp::Mode mode )
+            {
+                for( Slot& slot : m_slots )
+                { slot.ramp = ColorRamp( mode ); }
+            }
+
+            //* ramp, and the end points last requested, for a given key
+            struct Slot
+            {
+                ColorRamp ramp;
+                quint64 pending = 0;
+            };
+
+            //* slot for given end points
+            Slot& slot( quint64 key )
+            { return m_slots[ qHash( key ) % Size ]; }
+
+            private:
+
+            Slot m_slots[Size];
+
+        };
+
+        //* hue, saturation and value interpolated independently
+        QColor mixHsv( const QColor &cstart, const QColor &cend, qreal progress )
+        {
+            int sh = cstart.hsvHue();
+            int eh = cend.hsvHue();
+            int ss = cstart.hsvSaturation();
+            int es = cend.hsvSaturation();
+            int sv = cstart.value();
+            int ev = cend.value();
+            int hr = qAbs( sh - eh );
+            int sr = qAbs( ss - es );
+            int vr = qAbs( sv - ev );
+            int dirh =  sh > eh ? -1 : 1;
+            int dirs =  ss > es ? -1 : 1;
+            int dirv =  sv > ev ? -1 : 1;
+
+            return QColor::fromHsv( sh + dirh * progress * hr,
+                                    ss + dirs * progress * sr,
+                                    sv + dirv * progress * vr );
+        }
+
+        //* transition color, as computed for ramps
+        QColor mix( const QColor& start, const QColor& end, qreal progress, ColorRamp::Mode mode )
+        { return mode == ColorRamp::Hsv ? mixHsv( start, end, progress ) : KColorUtils::mix( start, end, progress ); }
+
+    }
+
+    //__________________________________________________________________
+    void ColorRamp::update( const QColor& start, const QColor& end )
+    {
+        const QRgb startRgba( start.rgba() );
+        const QRgb endRgba( end.rgba() );
+        if( m_valid && m_start == startRgba && m_end == endRgba ) return;
+
+        for( int i = 0; i <= Steps; ++i )
+        {
+            const qreal progress( qreal( i )/Steps );
+            m_colors[i] = mix( start, end, progress, m_mode ).rgba();
+        }
+
+        m_start = startRgba;
+        m_end = endRgba;
+        m_valid = true;
+    }
+
+    //__________________________________________________________________
+    QColor ColorRamp::shared( const QColor& start, const QColor& end, qreal progress, Mode mode )
+    {
+        static SharedRamps rgbRamps( Rgb );
+        static SharedRamps hsvRamps( Hsv );
+
+        const quint64 key( quint64( start.rgba() ) << 32 | end.rgba() );
+        SharedRamps::Slot& slot( ( mode == Hsv ? hsvRamps : rgbRamps ).slot( key ) );
+        if( slot.ramp.matches( start, end ) ) return slot.ramp.at( progress );
+
+        // end points seen for the first time, typically animated ones.
+        // Progress is rounded to a ramp step, so that the color matches the ramp
+        if( slot.pending != key )
+        {
+            slot.pending = key;
+            return QColor::fromRgba( mix( start, end, qBound( 0, qRound( progress*Steps ), int( Steps ) )/qreal( Steps ), mode ).rgba() );
+        }
+
+        slot.ramp.update( start, end );
+        return slot.ramp.at( progress );
+    }
+
+}
@@ -0,0 +1,91 @@
+#ifndef BREEZE_COLORRAMP_H
+#define BREEZE_COLORRAMP_H
+
+/*
+* Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This program is free software; you can redistribute it and/or
+* modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation; either version 2 of
+* the License or (at your option) version 3 or any later version
+* accepted by the membership of KDE e.V. (or its successor approved
+* by the membership of KDE e.V.), which shall act as a proxy
+* defined in Section 14 of version 3 of the license.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <QColor>
+
+namespace Breeze
+{
+
+    //* precomputed transition between two colors, indexed by animation progress
+    class ColorRamp
+    {
+        public:
+
+        //* number of steps between start and end color.
+        /** it is a multiple of the button hover animation frames, so that each frame maps to an exact entry */
+        enum { Steps = 60 };
+
+        //* interpolation
+        enum Mode
+        {
+            //* linear mix of the rgb components, as done by KColorUtils::mix
+            Rgb,
+
+            //* independent interpolation of hue, saturation and value
+            Hsv
+        };
+
+        //* constructor
+        explicit ColorRamp( Mode mode = Rgb ):
+            m_mode( mode )
+        {}
+
+        //* recompute the ramp if the end points changed
+        void update( const QColor& start, const QColor& end );
+
+        //* true if the ramp was computed for these end points
+        bool matches( const QColor& start, const QColor& end ) const
+        { return m_valid && m_start == start.rgba() && m_end == end.rgba(); }
+
+        //* color at a given progress, between 0 and 1
+        QColor at( qreal progress ) const
+        { return QColor::fromRgba( m_colors[ qBound( 0, qRound( progress*Steps ), int( Steps ) ) ] ); }
+
+        //*@name transitions between two colors, using ramps shared by all buttons
+        //@{
+        static QColor rgb( const QColor& start, const QColor& end, qreal progress )
+        { return shared( start, end, progress, Rgb ); }
+
+        static QColor hsv( const QColor& start, const QColor& end, qreal progress )
+        { return shared( start, end, progress, Hsv ); }
+        //@}
+
+        private:
+
+        //* look up or fill a shared ramp
+        /**
+        shared ramps are preallocated. End points requested for the first time are mixed directly,
+        and only get a ramp when requested again, so that animated end points never fill one
+        */
+        static QColor shared( const QColor& start, const QColor& end, qreal progress, Mode );
+
+        Mode m_mode;
+        bool m_valid = false;
+        QRgb m_start = 0;
+        QRgb m_end = 0;
+        QRgb m_colors[Steps + 1];
+
+    };
+
+}
+
+#endif
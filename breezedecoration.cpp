@@ -44,6 +44,7 @@
 #include <KPluginFactory>
 
 #include <QPainter>
+#include <QtMath>
 #include <QTextStream>
 #include <QTimer>
 
@@ -51,6 +52,7 @@
 #include <QX11Info>
 #endif
 
+#include <algorithm>
 #include <cmath>
 
 K_PLUGIN_FACTORY_WITH_JSON(
@@ -193,17 +195,22 @@ namespace Breeze
     {
         g_sDecoCount--;
         if (g_sDecoCount == 0) {
-            // last deco destroyed, clean up shadow
+            // last deco destroyed, clean up shadow and button pixmaps
             g_sShadow.clear();
+            Button::clearPixmapCache();
         }
 
         deleteSizeGrip();
 
+        if( m_windowId ) SettingsProvider::self()->forgetWindow( m_windowId );
+
     }
 
     //________________________________________________________________
     void Decoration::setOpacity( qreal value )
     {
+        // snap to the color ramp steps, so that ticks in between do not repaint
+        value = qRound( value*ColorRamp::Steps )/qreal( ColorRamp::Steps );
         if( m_opacity == value ) return;
         m_opacity = value;
         update();
@@ -291,10 +298,10 @@ namespace Breeze
         if ( !matchColorForTitleBar() ) {
             if( m_animation->state() == QAbstractAnimation::Running )
             {
-                titleBarColor = KColorUtils::mix(
+                m_titleBarRamp.update(
                     c->color( ColorGroup::Inactive, ColorRole::TitleBar ),
-                    c->color( ColorGroup::Active, ColorRole::TitleBar ),
-                    m_opacity );
+                    c->color( ColorGroup::Active, ColorRole::TitleBar ) );
+                titleBarColor = m_titleBarRamp.at( m_opacity );
             } else titleBarColor = c->color( c->isActive() ? ColorGroup::Active : ColorGroup::Inactive, ColorRole::TitleBar );
         }
         else {
@@ -311,10 +318,10 @@ namespace Breeze
 
          if (systemForegroundColor()) {
              if( m_animation->state() == QAbstractAnimation::Running ) {
-                 return KColorUtils::mix(
+                 m_fontRamp.update(
                         c->color( ColorGroup::Inactive, ColorRole::Foreground ),
-                        c->color( ColorGroup::Active, ColorRole::Foreground ),
-                        m_opacity );
+                        c->color( ColorGroup::Active, ColorRole::Foreground ) );
+                 return m_fontRamp.at( m_opacity );
              }
              else {
                  return  c->color( c->isActive() ? ColorGroup::Active : ColorGroup::Inactive, ColorRole::Foreground );
@@ -355,28 +362,62 @@ namespace Breeze
     //________________________________________________________________
     void Decoration::hoverMoveEvent(QHoverEvent *event)
     {
-        if (objectName() != "applet-window-buttons") {
-            const bool groupContains = m_leftButtons->geometry().contains(event->posF()) || m_rightButtons->geometry().contains(event->posF());
-            setButtonHovered(groupContains);
-        }
+        // setButtonHovered only notifies on enter and leave
+        if (!isAppletWindowButtons()) setButtonHovered(buttonGroupContains(event->posF()));
 
         KDecoration2::Decoration::hoverMoveEvent(event);
     }
 
+    //________________________________________________________________
+    bool Decoration::buttonGroupContains(const QPointF &position) const
+    {
+        // first span that does not end before position
+        const auto span = std::lower_bound( m_hitMap.constBegin(), m_hitMap.constEnd(), position.x(),
+            []( const HitSpan& span, qreal x ) { return span.right < x; } );
+
+        return span != m_hitMap.constEnd()
+            && span->left <= position.x()
+            && span->top <= position.y()
+            && position.y() <= span->bottom;
+    }
+
+    //________________________________________________________________
+    void Decoration::updateHitMap()
+    {
+        m_hitMap.clear();
+        if( !m_leftButtons || !m_rightButtons ) return;
+
+        for( auto group : { m_leftButtons, m_rightButtons } )
+        {
+            const QRectF geometry( group->geometry() );
+            if( geometry.width() <= 0 || geometry.height() <= 0 ) continue;
+            m_hitMap.append( { geometry.left(), geometry.right(), geometry.top(), geometry.bottom() } );
+        }
+
+        // groups never overlap, so sorting by left edge also sorts right edges
+        std::sort( m_hitMap.begin(), m_hitMap.end(),
+            []( const HitSpan& first, const HitSpan& second ) { return first.left < second.left; } );
+    }
+
     //________________________________________________________________
     void Decoration::init()
     {
         auto c = client().toStrongRef().data();
+        m_windowId = c->windowId();
 
         // active state change animation
-        // It is important start and end value are of the same type, hence 0.0 and not just 0
-        m_animation->setStartValue( 0.0 );
-        m_animation->setEndValue( 1.0 );
-        // Linear to have the same easing as Breeze animations
-        m_animation->setEasingCurve( QEasingCurve::Linear );
-        connect(m_animation, &QVariantAnimation::valueChanged, this, [this](const QVariant &value) {
-            setOpacity(value.toReal());
-        });
+        // panel applets only render buttons, which do not follow the decoration opacity
+        if( !isAppletWindowButtons() )
+        {
+            // It is important start and end value are of the same type, hence 0.0 and not just 0
+            m_animation->setStartValue( 0.0 );
+            m_animation->setEndValue( 1.0 );
+            // Linear to have the same easing as Breeze animations
+            m_animation->setEasingCurve( QEasingCurve::Linear );
+            connect(m_animation, &QVariantAnimation::valueChanged, this, [this](const QVariant &value) {
+                setOpacity(value.toReal());
+            });
+        }
 
         reconfigure();
         updateTitleBar();
@@ -395,10 +436,13 @@ namespace Breeze
         connect(s.data(), &KDecoration2::DecorationSettings::decorationButtonsLeftChanged, this, &Decoration::updateButtonsGeometryDelayed);
         connect(s.data(), &KDecoration2::DecorationSettings::decorationButtonsRightChanged, this, &Decoration::updateButtonsGeometryDelayed);
 
-        // full reconfiguration
-        connect(s.data(), &KDecoration2::DecorationSettings::reconfigured, this, &Decoration::reconfigure);
+        // settings are reloaded once by the provider, which then reports what changed
         connect(s.data(), &KDecoration2::DecorationSettings::reconfigured, SettingsProvider::self(), &SettingsProvider::reconfigure, Qt::UniqueConnection );
-        connect(s.data(), &KDecoration2::DecorationSettings::reconfigured, this, &Decoration::updateButtonsGeometryDelayed);
+        connect(SettingsProvider::self(), &SettingsProvider::changed, this, &Decoration::applyChanges);
+
+        // window class and role are read asynchronously: the first settings only know the caption
+        connect(SettingsProvider::self(), &SettingsProvider::windowPropertiesChanged, this,
+            [this]( WId windowId ) { if( windowId == m_windowId ) updateTitleExceptions(); } );
 
         connect(c, &KDecoration2::DecoratedClient::adjacentScreenEdgesChanged, this, &Decoration::recalculateBorders);
         connect(c, &KDecoration2::DecoratedClient::maximizedHorizontallyChanged, this, &Decoration::recalculateBorders);
@@ -409,15 +453,23 @@ namespace Breeze
             {
                 // update the caption area
                 update(titleBar());
+
+                // title exceptions might now resolve differently
+                if( SettingsProvider::self()->hasTitleExceptions() ) updateTitleExceptionsDelayed();
             }
         );
 
-        connect(c, &KDecoration2::DecoratedClient::activeChanged, this, &Decoration::updateAnimationState);
-        connect(c, &KDecoration2::DecoratedClient::activeChanged, this, &Decoration::createShadow);
-        connect(c, &KDecoration2::DecoratedClient::activeChanged, this, &Decoration::updateBlur);
+        if( !isAppletWindowButtons() )
+        {
+            // panel applets only render buttons, they have no shadow nor blur, and do not animate
+            connect(c, &KDecoration2::DecoratedClient::activeChanged, this, &Decoration::updateAnimationState);
+            connect(c, &KDecoration2::DecoratedClient::activeChanged, this, &Decoration::createShadow);
+            connect(c, &KDecoration2::DecoratedClient::activeChanged, this, &Decoration::updateBlur);
+        } else connect(c, &KDecoration2::DecoratedClient::activeChanged, this, [this]() { update(); });
         connect(c, &KDecoration2::DecoratedClient::widthChanged, this, &Decoration::updateTitleBar);
         connect(c, &KDecoration2::DecoratedClient::maximizedChanged, this, &Decoration::updateTitleBar);
-        //connect(c, &KDecoration2::DecoratedClient::maximizedChanged, this, &Decoration::setOpaque);
+        connect(c, &KDecoration2::DecoratedClient::maximizedChanged, this, &Decoration::updateOpaque);
+        connect(c, &KDecoration2::DecoratedClient::maximizedChanged, this, &Decoration::updateBlur);
         connect(c, &KDecoration2::DecoratedClient::sizeChanged, this, &Decoration::updateBlur);
 
         connect(c, &KDecoration2::DecoratedClient::widthChanged, this, &Decoration::updateButtonsGeometry);
@@ -705,6 +757,7 @@ namespace Breeze
         // borders
         recalculateBorders();
 
+        updateOpaque();
         updateBlur();
 
         // shadow
@@ -714,6 +767,93 @@ namespace Breeze
         if( borderSize() <= 1 && m_internalSettings->drawSizeGrip() ) createSizeGrip();
         else deleteSizeGrip();
 
+        // buttons
+        if( m_leftButtons && m_rightButtons )
+        {
+            foreach( const QPointer<KDecoration2::DecorationButton>& button, m_leftButtons->buttons() + m_rightButtons->buttons() )
+            { if( button ) static_cast<Button*>( button.data() )->reconfigure(); }
+        }
+
+        // button style and colors may have changed
+        invalidateButtonStrips();
+
+    }
+
+    //________________________________________________________________
+    void Decoration::updateTitleExceptionsDelayed()
+    {
+        // applications may retitle many times per second, only the last caption is matched
+        if( !m_captionTimer )
+        {
+            m_captionTimer = new QTimer( this );
+            m_captionTimer->setSingleShot( true );
+            m_captionTimer->setInterval( CaptionDelay );
+            connect( m_captionTimer, &QTimer::timeout, this, &Decoration::updateTitleExceptions );
+        }
+
+        m_captionTimer->start();
+    }
+
+    //________________________________________________________________
+    void Decoration::updateTitleExceptions()
+    {
+        // full reconfiguration only if the window now resolves to other settings
+        if( SettingsProvider::self()->internalSettings( this ) == m_internalSettings ) return;
+        reconfigure();
+        updateButtonsGeometryDelayed();
+    }
+
+    //________________________________________________________________
+    void Decoration::applyChanges( SettingsProvider::Changes changes )
+    {
+
+        // layout changes need a full reconfiguration
+        if( changes & SettingsProvider::GeometryChanged )
+        {
+            reconfigure();
+            updateButtonsGeometryDelayed();
+            return;
+        }
+
+        // unchanged exceptions keep their object: windows still resolving to the same one are not affected
+        const InternalSettingsPtr internalSettings( SettingsProvider::self()->internalSettings( this ) );
+        if( changes & SettingsProvider::ExceptionsChanged )
+        {
+            if( internalSettings == m_internalSettings ) return;
+
+            reconfigure();
+            updateButtonsGeometryDelayed();
+            return;
+        }
+
+        // settings are a new snapshot even if only a few values changed
+        m_internalSettings = internalSettings;
+
+        if( changes & ( SettingsProvider::AnimationsChanged | SettingsProvider::ColorsChanged ) )
+        {
+            if( changes & SettingsProvider::AnimationsChanged )
+            { m_animation->setDuration( m_internalSettings->animationsDuration() ); }
+
+            if( m_leftButtons && m_rightButtons )
+            {
+                foreach( const QPointer<KDecoration2::DecorationButton>& button, m_leftButtons->buttons() + m_rightButtons->buttons() )
+                { if( button ) static_cast<Button*>( button.data() )->reconfigure(); }
+            }
+
+            // button strips depend on colors, and on animations through radius and pen widths
+            invalidateButtonStrips();
+            update();
+        }
+
+        if( changes & SettingsProvider::ColorsChanged )
+        {
+            // opacity decides whether the decoration is opaque, and the title bar blurred
+            updateOpaque();
+            updateBlur();
+        }
+
+        if( changes & SettingsProvider::ShadowChanged ) createShadow();
+
     }
 
     //________________________________________________________________
@@ -764,17 +904,23 @@ namespace Breeze
     {
         m_leftButtons = new KDecoration2::DecorationButtonGroup(KDecoration2::DecorationButtonGroup::Position::Left, this, &Button::create);
         m_rightButtons = new KDecoration2::DecorationButtonGroup(KDecoration2::DecorationButtonGroup::Position::Right, this, &Button::create);
+
+        // group geometry also changes when buttons are shown or hidden
+        connect(m_leftButtons, &KDecoration2::DecorationButtonGroup::geometryChanged, this, &Decoration::updateHitMap);
+        connect(m_rightButtons, &KDecoration2::DecorationButtonGroup::geometryChanged, this, &Decoration::updateHitMap);
         updateButtonsGeometry();
     }
 
     void Decoration::updateBlur()
     {
+        if( isAppletWindowButtons() ) return;
+
         // access client
         auto c = client().toStrongRef();
         Q_ASSERT(c);
 
         //disable blur if the titlebar is opaque
-        if( (m_internalSettings->opaqueTitleBar() && c->isMaximized() )
+        if( isOpaque() || (m_internalSettings->opaqueTitleBar() && c->isMaximized() )
             || ( m_opacity == 100 && this->titleBarColor().alpha() == 255 )
         ){ //opaque titlebar colours
             setBlurRegion( QRegion() );
@@ -785,6 +931,21 @@ namespace Breeze
         }
     }
 
+    //________________________________________________________________
+    void Decoration::updateOpaque()
+    {
+        // panel applets only render buttons
+        if( isAppletWindowButtons() ) return;
+
+        auto s = settings();
+
+        // rounded corners leave transparent pixels, unless maximized windows are configured to drop them
+        const bool squareCorners( !s->isAlphaChannelSupported() || ( isMaximized() && m_internalSettings->disableCornersShaderForMaximized() ) || m_internalSettings->cornerRadius() <= 0 );
+
+        // lets the compositor skip whatever the decoration hides
+        setOpaque( squareCorners && titleBarAlpha() == 255 );
+    }
+
     void Decoration::calculateWindowAndTitleBarShapes(const bool windowShapeOnly)
     {
         auto c = client().toStrongRef();
@@ -939,6 +1100,9 @@ namespace Breeze
 
         }
 
+        // icon sizes and offsets are not part of the strip state
+        invalidateButtonStrips();
+        updateHitMap();
         update();
 
     }
@@ -1027,6 +1191,107 @@ namespace Breeze
 
     }
 
+    //________________________________________________________________
+    void Decoration::paintButtons(QPainter *painter, KDecoration2::DecorationButtonGroup *group, ButtonStrip &strip, const QRect &repaintRegion)
+    {
+        const QRectF geometry( group->geometry() );
+        if( group->buttons().isEmpty() || !geometry.intersects( repaintRegion ) ) return;
+
+        // only idle groups are cached, the others are painted button by button
+        bool idle = m_animation->state() != QAbstractAnimation::Running && !( m_buttonHovered && m_internalSettings->unisonHovering() );
+
+        ButtonStates states;
+        ButtonGeometries geometries;
+        qint64 iconKey = 0;
+        auto c = client().toStrongRef().data();
+        foreach( const QPointer<KDecoration2::DecorationButton>& button, group->buttons() )
+        {
+            auto b = static_cast<Button*>( button.data() );
+            if( !b ) continue;
+            if( b->isHovered() || b->isPressed() || b->isAnimating() )
+            {
+                idle = false;
+                break;
+            }
+
+            states.append( int( b->type() ) << 3 | ( b->isVisible() ? 1:0 ) | ( b->isEnabled() ? 2:0 ) | ( b->isChecked() ? 4:0 ) );
+            geometries.append( b->geometry() );
+            if( b->type() == KDecoration2::DecorationButtonType::Menu ) iconKey = c->icon().cacheKey();
+        }
+
+        if( !idle )
+        {
+            group->paint( painter, repaintRegion );
+            return;
+        }
+
+        const qreal devicePixelRatio( painter->device()->devicePixelRatioF() );
+        const QRgb titleBarColor( this->titleBarColor().rgba() );
+        const QRgb fontColor( this->fontColor().rgba() );
+        const int drawingFlags( buttonDrawingFlags() );
+
+        if( strip.pixmap.isNull()
+            || strip.geometry != geometry
+            || !qFuzzyCompare( strip.devicePixelRatio, devicePixelRatio )
+            || strip.titleBarColor != titleBarColor
+            || strip.fontColor != fontColor
+            || strip.drawingFlags != drawingFlags
+            || strip.iconKey != iconKey
+            || strip.states != states
+            || strip.geometries != geometries )
+        {
+
+            // align the strip on device pixels, with a margin for antialiased edges
+            const int margin = 2;
+            const QPoint origin( qFloor( geometry.left() ) - margin, qFloor( geometry.top() ) - margin );
+            const QSize size( qCeil( geometry.right() ) + margin - origin.x(), qCeil( geometry.bottom() ) + margin - origin.y() );
+
+            QPixmap pixmap( size*devicePixelRatio );
+            pixmap.setDevicePixelRatio( devicePixelRatio );
+            pixmap.fill( Qt::transparent );
+
+            QPainter stripPainter( &pixmap );
+            stripPainter.translate( -origin );
+            group->paint( &stripPainter, QRect( origin, size ) );
+            stripPainter.end();
+
+            strip.pixmap = pixmap;
+            strip.origin = origin;
+            strip.geometry = geometry;
+            strip.devicePixelRatio = devicePixelRatio;
+            strip.titleBarColor = titleBarColor;
+            strip.fontColor = fontColor;
+            strip.drawingFlags = drawingFlags;
+            strip.iconKey = iconKey;
+            strip.states = states;
+            strip.geometries = geometries;
+
+        }
+
+        painter->drawPixmap( strip.origin, strip.pixmap );
+    }
+
+    //________________________________________________________________
+    void Decoration::invalidateButtonStrips()
+    {
+        m_leftButtonStrip.pixmap = QPixmap();
+        m_rightButtonStrip.pixmap = QPixmap();
+    }
+
+    //________________________________________________________________
+    int Decoration::buttonDrawingFlags() const
+    {
+        // inactive windows use different symbol and button colors,
+        // and disabling animations changes button radius and pen widths
+        auto c = client().toStrongRef().data();
+        return
+            ( c->isActive() ? 1<<0 : 0 ) |
+            ( m_internalSettings->animationsEnabled() ? 1<<1 : 0 ) |
+            ( m_internalSettings->matchColorForTitleBar() ? 1<<2 : 0 ) |
+            ( m_internalSettings->systemForegroundColor() ? 1<<3 : 0 ) |
+            m_internalSettings->buttonStyle() << 4;
+    }
+
     //________________________________________________________________
     void Decoration::paintTitleBar(QPainter *painter, const QRect &repaintRegion)
     {
@@ -1098,8 +1363,8 @@ namespace Breeze
 
         if( !hideTitleBar() ) {
           // draw all buttons
-          m_leftButtons->paint(painter, repaintRegion);
-          m_rightButtons->paint(painter, repaintRegion);
+          paintButtons(painter, m_leftButtons, m_leftButtonStrip, repaintRegion);
+          paintButtons(painter, m_rightButtons, m_rightButtonStrip, repaintRegion);
 
           // draw caption
 
@@ -1190,6 +1455,8 @@ namespace Breeze
     //________________________________________________________________
     void Decoration::createShadow()
     {
+        if( isAppletWindowButtons() ) return;
+
         if ( !g_sShadow ) {
             g_shadowSizeEnum = m_internalSettings->shadowSize();
             g_shadowStrength = m_internalSettings->shadowStrength();
@@ -1229,8 +1496,8 @@ namespace Breeze
     void Decoration::createSizeGrip()
     {
 
-        // do nothing if size grip already exist
-        if( m_sizeGrip ) return;
+        // do nothing if size grip already exist, or if there is no window to resize
+        if( m_sizeGrip || isAppletWindowButtons() ) return;
 
         #if BREEZE_HAVE_X11
         if( !QX11Info::isPlatformX11() ) return;
@@ -23,15 +23,20 @@
  */
 
 #include "breeze.h"
+#include "breezecolorramp.h"
 #include "breezesettings.h"
+#include "breezesettingsprovider.h"
 
 #include <KDecoration2/Decoration>
 #include <KDecoration2/DecoratedClient>
 #include <KDecoration2/DecorationSettings>
 
 #include <QPalette>
+#include <QTimer>
+#include <QPixmap>
 #include <QVariant>
 #include <QVariantAnimation>
+#include <QVarLengthArray>
 #include <QPainterPath>
 
 class QVariantAnimation;
@@ -100,6 +105,7 @@ namespace Breeze
         inline bool isBottomEdge() const;
 
         inline bool hideTitleBar() const;
+        inline bool isAppletWindowButtons() const;
         inline int titleBarAlpha() const;
         inline bool matchColorForTitleBar() const;
         inline bool drawBackgroundGradient() const;
@@ -128,13 +134,17 @@ namespace Breeze
 
         private Q_SLOTS:
         void reconfigure();
+        void applyChanges(SettingsProvider::Changes);
+        void updateTitleExceptions();
         void recalculateBorders();
         void updateButtonsGeometry();
         void updateButtonsGeometryDelayed();
+        void updateHitMap();
         void updateTitleBar();
         void updateAnimationState();
         void updateSizeGripVisibility();
         void updateBlur();
+        void updateOpaque();
         void createShadow();
 
         private:
@@ -144,6 +154,43 @@ namespace Breeze
 
         void createButtons();
         void paintTitleBar(QPainter *painter, const QRect &repaintRegion);
+
+        //*@name button states and geometries a strip was rendered for, without allocation for usual button groups
+        //@{
+        using ButtonStates = QVarLengthArray<int, 8>;
+        using ButtonGeometries = QVarLengthArray<QRectF, 8>;
+        //@}
+
+        //* cached rendering of an idle button group, and the state it was rendered for
+        struct ButtonStrip
+        {
+            QPixmap pixmap;
+            QPoint origin;
+            QRectF geometry;
+            qreal devicePixelRatio = 0;
+            QRgb titleBarColor = 0;
+            QRgb fontColor = 0;
+            int drawingFlags = -1;
+            qint64 iconKey = 0;
+            ButtonStates states;
+            ButtonGeometries geometries;
+        };
+
+        //* paint button group, from its cached strip when no button is hovered, pressed or animating
+        void paintButtons(QPainter *painter, KDecoration2::DecorationButtonGroup *group, ButtonStrip &strip, const QRect &repaintRegion);
+
+        //* discard cached button strips
+        void invalidateButtonStrips();
+
+        //* window state and settings that change how buttons are drawn, as stored in ButtonStrip
+        int buttonDrawingFlags() const;
+
+        //* re-match title exceptions once the caption stops changing
+        void updateTitleExceptionsDelayed();
+
+        //* true if position is inside one of the button groups, looked up in the hit map
+        bool buttonGroupContains(const QPointF &position) const;
+
         void updateShadow();
         void updateActiveShadow();
         void updateInactiveShadow();
@@ -166,9 +213,37 @@ namespace Breeze
         //@}
 
         InternalSettingsPtr m_internalSettings;
+
+        //* decorated window id, kept to release cached window properties on destruction
+        WId m_windowId = 0;
+
         KDecoration2::DecorationButtonGroup *m_leftButtons = nullptr;
         KDecoration2::DecorationButtonGroup *m_rightButtons = nullptr;
 
+        //* title bar area covered by a button group, in decoration coordinates
+        struct HitSpan
+        {
+            qreal left;
+            qreal right;
+            qreal top;
+            qreal bottom;
+        };
+
+        //* button group spans, sorted by position along the title bar
+        QVector<HitSpan> m_hitMap;
+
+        //*@name cached idle button groups
+        //@{
+        ButtonStrip m_leftButtonStrip;
+        ButtonStrip m_rightButtonStrip;
+        //@}
+
+        //* delay before matching title exceptions against a new caption (ms)
+        enum { CaptionDelay = 250 };
+
+        //* caption change debounce timer, created on first use
+        QTimer *m_captionTimer = nullptr;
+
         //* size grip widget
         SizeGrip *m_sizeGrip = nullptr;
 
@@ -178,6 +253,12 @@ namespace Breeze
         //* active state change opacity
         qreal m_opacity = 0;
 
+        //*@name inactive to active color transitions, rebuilt when the palette changes
+        //@{
+        mutable ColorRamp m_titleBarRamp;
+        mutable ColorRamp m_fontRamp;
+        //@}
+
         //* Rectangular area of titlebar without clipped corners
         QRect m_titleRect;
         
@@ -229,6 +310,9 @@ namespace Breeze
     bool Decoration::hideTitleBar() const
     { return m_internalSettings->hideTitleBar() == 3 || ( m_internalSettings->hideTitleBar() == 1 && client().toStrongRef().data()->isMaximized() ) || ( m_internalSettings->hideTitleBar() == 2 && ( client().toStrongRef().data()->isMaximized() || client().toStrongRef().data()->isMaximizedVertically()  || client().toStrongRef().data()->isMaximizedHorizontally()) ); }
 
+    bool Decoration::isAppletWindowButtons() const
+    { return objectName() == QLatin1String( "applet-window-buttons" ); }
+
     int Decoration::titleBarAlpha() const
     {
         if (m_internalSettings->opaqueTitleBar())
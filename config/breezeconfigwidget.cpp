@@ -25,6 +25,7 @@
 
 #include "breezeconfigwidget.h"
 #include "breezeexceptionlist.h"
+#include "breezesettingscache.h"
 #include "breezesettings.h"
 #include "breezedecorationhelper.h"
 
@@ -221,6 +222,9 @@ namespace Breeze
         m_configuration->sync();
         setChanged( false );
 
+        // binary snapshot, read by the decoration instead of parsing the configuration file
+        SettingsCache::write( *m_internalSettings, exceptions );
+
         // needed to tell kwin to reload when running from external kcmshell
         {
             QDBusMessage message = QDBusMessage::createSignal("/KWin", "org.kde.KWin", "reloadConfig");
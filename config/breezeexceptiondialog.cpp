@@ -26,8 +26,11 @@
 #include "breezeexceptiondialog.h"
 #include "breezedetectwidget.h"
 #include "breezedecorationhelper.h"
+#include "breezeexceptionmatcher.h"
 #include "config-breeze.h"
 
+#include <KLocalizedString>
+
 #if BREEZE_HAVE_X11
 #include <QX11Info>
 #endif
@@ -53,17 +56,29 @@ namespace Breeze
         // store checkboxes from ui into list
         m_checkboxes.insert( BorderSize, m_ui.borderSizeCheckBox );
 
+        m_windowTypeCheckboxes.insert( NET::NormalMask, m_ui.normalWindowCheckBox );
+        m_windowTypeCheckboxes.insert( NET::DialogMask, m_ui.dialogWindowCheckBox );
+        m_windowTypeCheckboxes.insert( NET::UtilityMask, m_ui.utilityWindowCheckBox );
+        m_windowTypeCheckboxes.insert( NET::ToolbarMask, m_ui.toolbarWindowCheckBox );
+
         // detect window properties
         connect( m_ui.detectDialogButton, &QAbstractButton::clicked, this, &ExceptionDialog::selectWindowProperties );
 
         // connections
         connect( m_ui.exceptionType, SIGNAL(currentIndexChanged(int)), SLOT(updateChanged()) );
         connect( m_ui.exceptionEditor, &QLineEdit::textChanged, this, &ExceptionDialog::updateChanged );
+        connect( m_ui.exceptionEditor, &QLineEdit::textChanged, this, &ExceptionDialog::updatePatternWarning );
+        connect( m_ui.windowRoleEditor, &QLineEdit::textChanged, this, &ExceptionDialog::updateChanged );
+        connect( m_ui.desktopFileNameEditor, &QLineEdit::textChanged, this, &ExceptionDialog::updateChanged );
+        connect( m_ui.transientComboBox, SIGNAL(currentIndexChanged(int)), SLOT(updateChanged()) );
         connect( m_ui.borderSizeComboBox, SIGNAL(currentIndexChanged(int)), SLOT(updateChanged()) );
 
         for( CheckBoxMap::iterator iter = m_checkboxes.begin(); iter != m_checkboxes.end(); ++iter )
         { connect( iter.value(), &QAbstractButton::clicked, this, &ExceptionDialog::updateChanged ); }
 
+        foreach( QCheckBox* checkbox, m_windowTypeCheckboxes )
+        { connect( checkbox, &QAbstractButton::clicked, this, &ExceptionDialog::updateChanged ); }
+
         connect( m_ui.hideTitleBar, SIGNAL(currentIndexChanged(int)), SLOT(updateChanged()) );
         connect( m_ui.matchColorForTitleBar, &QAbstractButton::clicked, this, &ExceptionDialog::updateChanged );
         connect( m_ui.systemForegroundColor, &QAbstractButton::clicked, this, &ExceptionDialog::updateChanged );
@@ -103,6 +118,12 @@ namespace Breeze
         // type
         m_ui.exceptionType->setCurrentIndex(m_exception->exceptionType() );
         m_ui.exceptionEditor->setText( m_exception->exceptionPattern() );
+        m_ui.windowRoleEditor->setText( m_exception->exceptionWindowRole() );
+        m_ui.desktopFileNameEditor->setText( m_exception->exceptionDesktopFileName() );
+        m_ui.transientComboBox->setCurrentIndex( m_exception->exceptionTransient() );
+        for( auto iter = m_windowTypeCheckboxes.begin(); iter != m_windowTypeCheckboxes.end(); ++iter )
+        { iter.value()->setChecked( m_exception->exceptionWindowTypes() & iter.key() ); }
+
         m_ui.borderSizeComboBox->setCurrentIndex( m_exception->borderSize() );
         m_ui.hideTitleBar->setCurrentIndex( m_exception->hideTitleBar() );
         m_ui.matchColorForTitleBar->setChecked( m_exception->matchColorForTitleBar() );
@@ -127,6 +148,7 @@ namespace Breeze
         for( CheckBoxMap::iterator iter = m_checkboxes.begin(); iter != m_checkboxes.end(); ++iter )
         { iter.value()->setChecked( m_exception->mask() & iter.key() ); }
 
+        updatePatternWarning();
         setChanged( false );
 
     }
@@ -136,6 +158,10 @@ namespace Breeze
     {
         m_exception->setExceptionType( m_ui.exceptionType->currentIndex() );
         m_exception->setExceptionPattern( m_ui.exceptionEditor->text() );
+        m_exception->setExceptionWindowRole( m_ui.windowRoleEditor->text() );
+        m_exception->setExceptionDesktopFileName( m_ui.desktopFileNameEditor->text() );
+        m_exception->setExceptionWindowTypes( windowTypes() );
+        m_exception->setExceptionTransient( m_ui.transientComboBox->currentIndex() );
         m_exception->setBorderSize( m_ui.borderSizeComboBox->currentIndex() );
         m_exception->setHideTitleBar( m_ui.hideTitleBar->currentIndex() );
         m_exception->setMatchColorForTitleBar( m_ui.matchColorForTitleBar->isChecked() );
@@ -167,6 +193,53 @@ namespace Breeze
 
     }
 
+    //___________________________________________
+    void ExceptionDialog::updatePatternWarning()
+    {
+
+        // patterns are matched against every new window, from the compositor
+        ExceptionMatcher::Construct construct( ExceptionMatcher::NoConstruct );
+        ExceptionMatcher::estimateCost( m_ui.exceptionEditor->text(), &construct );
+
+        QString warning;
+        switch( construct )
+        {
+            case ExceptionMatcher::NestedQuantifiers:
+            warning = i18n( "Nested repetitions, such as \"(a+)+\", can take a very long time to match. Windows that take too long are not matched by this exception." );
+            break;
+
+            case ExceptionMatcher::BackReference:
+            warning = i18n( "Back references make matching slow. Windows that take too long are not matched by this exception." );
+            break;
+
+            case ExceptionMatcher::LargeAlternation:
+            warning = i18n( "This pattern has many alternatives. Consider splitting it into several exceptions." );
+            break;
+
+            case ExceptionMatcher::LongPattern:
+            warning = i18n( "This pattern is very long and may slow down opening windows." );
+            break;
+
+            default:
+            case ExceptionMatcher::NoConstruct:
+            break;
+        }
+
+        m_ui.patternWarning->setText( warning );
+        m_ui.patternWarning->setVisible( !warning.isEmpty() );
+
+    }
+
+    //___________________________________________
+    int ExceptionDialog::windowTypes() const
+    {
+        int mask = 0;
+        for( auto iter = m_windowTypeCheckboxes.constBegin(); iter != m_windowTypeCheckboxes.constEnd(); ++iter )
+        { if( iter.value()->isChecked() ) mask |= iter.key(); }
+
+        return mask;
+    }
+
     //___________________________________________
     void ExceptionDialog::updateChanged()
     {
@@ -180,6 +253,10 @@ namespace Breeze
 
         if( m_exception->exceptionType() != m_ui.exceptionType->currentIndex() ) modified = true;
         else if( m_exception->exceptionPattern() != m_ui.exceptionEditor->text() ) modified = true;
+        else if( m_exception->exceptionWindowRole() != m_ui.windowRoleEditor->text() ) modified = true;
+        else if( m_exception->exceptionDesktopFileName() != m_ui.desktopFileNameEditor->text() ) modified = true;
+        else if( m_exception->exceptionWindowTypes() != windowTypes() ) modified = true;
+        else if( m_exception->exceptionTransient() != m_ui.transientComboBox->currentIndex() ) modified = true;
         else if( m_exception->borderSize() != m_ui.borderSizeComboBox->currentIndex() ) modified = true;
         else if( m_exception->hideTitleBar() != m_ui.hideTitleBar->currentIndex() ) modified = true;
         else if( m_exception->matchColorForTitleBar() != m_ui.matchColorForTitleBar->isChecked() ) modified = true;
@@ -88,6 +88,9 @@ namespace Breeze
         //* read properties of selected window
         void readWindowProperties( bool );
 
+        //* warn about patterns that are expensive to match
+        void updatePatternWarning();
+
         private:
 
         //* map mask and checkbox
@@ -98,6 +101,12 @@ namespace Breeze
         //* map mask and checkbox
         CheckBoxMap m_checkboxes;
 
+        //* map NET window type mask and checkbox
+        QMap<int, QCheckBox*> m_windowTypeCheckboxes;
+
+        //* NET window type mask from checkboxes
+        int windowTypes() const;
+
         //* internal exception
         InternalSettingsPtr m_exception;
 
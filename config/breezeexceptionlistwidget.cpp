@@ -30,6 +30,7 @@
 
 #include <QMessageBox>
 #include <QPointer>
+#include <QRegularExpression>
 #include <QIcon>
 
 //__________________________________________________________
@@ -323,7 +324,14 @@ namespace Breeze
     bool ExceptionListWidget::checkException( InternalSettingsPtr exception )
     {
 
-        while( exception->exceptionPattern().isEmpty() || !QRegExp( exception->exceptionPattern() ).isValid() )
+        // an empty pattern is only allowed when some other criterion restricts the matching windows
+        auto hasCriteria = []( const InternalSettingsPtr& exception )
+        {
+            return !exception->exceptionWindowRole().isEmpty() || !exception->exceptionDesktopFileName().isEmpty() ||
+                exception->exceptionWindowTypes() || exception->exceptionTransient() != InternalSettings::TransientAny;
+        };
+
+        while( ( exception->exceptionPattern().isEmpty() && !hasCriteria( exception ) ) || !QRegularExpression( exception->exceptionPattern() ).isValid() )
         {
 
             QMessageBox::warning( this, i18n( "Warning - Breeze Settings" ), i18n("Regular Expression syntax is incorrect") );
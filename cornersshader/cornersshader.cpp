@@ -138,6 +138,21 @@ CornersShaderEffect::CornersShaderEffect() : OffscreenEffect()
         connect(effects, &EffectsHandler::windowDeleted, this, &CornersShaderEffect::windowDeleted);
         connect(effects, &EffectsHandler::windowMaximizedStateChanged, this, &CornersShaderEffect::windowMaximizedStateChanged);
         connect(effects, &EffectsHandler::windowDecorationChanged, this, &CornersShaderEffect::setupDecorationConnections);
+        connect(Breeze::SettingsProvider::self(), &Breeze::SettingsProvider::changed, this, [this](Breeze::SettingsProvider::Changes changes) {
+            // masks only depend on default settings
+            if (changes == Breeze::SettingsProvider::ExceptionsChanged) {
+                updateWindowSettings();
+            } else {
+                reconfigure(ReconfigureAll);
+            }
+        });
+        connect(Breeze::SettingsProvider::self(), &Breeze::SettingsProvider::windowPropertiesChanged, this, [this](WId windowId) {
+            // desktop file names of X11 windows are read asynchronously by the provider
+            EffectWindow *w = effects->findWindow(windowId);
+            if (w && m_windows.contains(w) && m_windows[w].isManaged) {
+                m_windows[w].settings = windowSettings(w);
+            }
+        });
     }
     else
         qDebug() << "CornersShader: no valid shaders found! CornersShader will not work.";
@@ -173,6 +188,10 @@ CornersShaderEffect::~CornersShaderEffect()
 void
 CornersShaderEffect::windowDeleted(EffectWindow *w)
 {
+    if (w->isX11Client()) {
+        Breeze::SettingsProvider::self()->forgetWindow(w->windowId());
+    }
+
     m_windows.remove(w);
 }
 
@@ -187,6 +206,7 @@ void
 CornersShaderEffect::windowAdded(EffectWindow *w)
 {
     m_windows[w].isManaged = false;
+    m_windows[w].classFlags = Breeze::WindowClass::flags(w->windowClass());
 
     if (w->windowType() == NET::OnScreenDisplay
             || w->windowType() == NET::Dock
@@ -197,23 +217,16 @@ CornersShaderEffect::windowAdded(EffectWindow *w)
             || w->windowType() == NET::Splash)
         return;
 //    qDebug() << w->windowRole() << w->windowType() << w->windowClass();
-    if (!w->hasDecoration() && (w->windowClass().contains("plasma", Qt::CaseInsensitive)
-            || w->windowClass().contains("krunner", Qt::CaseInsensitive)
-            || w->windowClass().contains("latte-dock", Qt::CaseInsensitive)
-            || w->windowClass().contains("lattedock", Qt::CaseInsensitive)
-            || w->windowClass().contains("plank", Qt::CaseInsensitive)
-            || w->windowClass().contains("cairo-dock", Qt::CaseInsensitive)
-            || w->windowClass().contains("albert", Qt::CaseInsensitive)
-            || w->windowClass().contains("ulauncher", Qt::CaseInsensitive)
-            || w->windowClass().contains("ksplash", Qt::CaseInsensitive)
-            || w->windowClass().contains("ksmserver", Qt::CaseInsensitive)
-            || (w->windowClass().contains("reaper", Qt::CaseInsensitive) && !hasShadow(w))))
+    const Breeze::WindowClass::Flags classFlags = m_windows[w].classFlags;
+    if (!w->hasDecoration() && ((classFlags & Breeze::WindowClass::Shell)
+            || ((classFlags & Breeze::WindowClass::Reaper) && !hasShadow(w))))
         return;
 
-    if(w->windowClass().contains("jetbrains", Qt::CaseInsensitive) && w->caption().contains(QRegularExpression ("win[0-9]+")))
+    static const QRegularExpression jetBrainsPopup(QStringLiteral("win[0-9]+"));
+    if((classFlags & Breeze::WindowClass::JetBrains) && w->caption().contains(jetBrainsPopup))
         return;
 
-    if (w->windowClass().contains("plasma", Qt::CaseInsensitive) && !w->isNormalWindow() && !w->isDialog() && !w->isModal())
+    if ((classFlags & Breeze::WindowClass::Plasma) && !w->isNormalWindow() && !w->isDialog() && !w->isModal())
         return;
 
     if (w->isDesktop()
@@ -227,7 +240,7 @@ CornersShaderEffect::windowAdded(EffectWindow *w)
             || w->isSplash())
         return;
 
-    m_windows[w].settings = Breeze::SettingsProvider::self()->internalSettings(w->windowClass(), w->caption());
+    m_windows[w].settings = windowSettings(w);
 
     m_windows[w].isManaged = true;
     m_windows[w].skipEffect = false;
@@ -254,6 +267,43 @@ CornersShaderEffect::windowMaximizedStateChanged(EffectWindow *w, bool horizonta
     }
 }
 
+Breeze::InternalSettingsPtr
+CornersShaderEffect::windowSettings(EffectWindow *w) const
+{
+    // use the window data kwin already has, rather than querying the X server again
+    Breeze::SettingsProvider::WindowProperties properties;
+    properties.className = w->windowClass();
+    properties.classId = Breeze::WindowClass::id(properties.className);
+    properties.caption = w->caption();
+    properties.type = w->isDialog() ? Breeze::SettingsProvider::WindowProperties::Dialog : Breeze::SettingsProvider::WindowProperties::NotDialog;
+    properties.windowType = w->windowType();
+    properties.role = QString::fromUtf8(w->windowRole());
+    properties.transient = w->mainWindows().isEmpty() ? Breeze::SettingsProvider::WindowProperties::NotTransient : Breeze::SettingsProvider::WindowProperties::IsTransient;
+    properties.known = Breeze::SettingsProvider::WindowProperties::KnownRole;
+
+    // kwin does not expose desktop file names to effects. Share the one the decoration reads, so that both match the same exception
+    if (w->isX11Client()) {
+        const Breeze::SettingsProvider::WindowProperties x11Properties = Breeze::SettingsProvider::self()->windowProperties(w->windowId());
+        if (x11Properties.known & Breeze::SettingsProvider::WindowProperties::KnownDesktopFileName) {
+            properties.desktopFileName = x11Properties.desktopFileName;
+            properties.known |= Breeze::SettingsProvider::WindowProperties::KnownDesktopFileName;
+        }
+    }
+
+    return Breeze::SettingsProvider::self()->internalSettings(properties);
+}
+
+void
+CornersShaderEffect::updateWindowSettings()
+{
+    // settings are replaced, not modified, when they change
+    for (auto it = m_windows.begin(); it != m_windows.end(); ++it) {
+        if (it.value().isManaged) {
+            it.value().settings = windowSettings(it.key());
+        }
+    }
+}
+
 void
 CornersShaderEffect::setupDecorationConnections(EffectWindow *w)
 {
@@ -261,9 +311,8 @@ CornersShaderEffect::setupDecorationConnections(EffectWindow *w)
         return;
     }
 
-    connect(w->decoration()->settings().data(), &KDecoration2::DecorationSettings::reconfigured, this, [this]() {
-        reconfigure(ReconfigureAll);
-    });
+    // the provider reloads settings once, and notifies this effect when they actually changed
+    connect(w->decoration()->settings().data(), &KDecoration2::DecorationSettings::reconfigured, Breeze::SettingsProvider::self(), &Breeze::SettingsProvider::reconfigure, Qt::UniqueConnection);
 }
 
 QImage
@@ -395,6 +444,8 @@ CornersShaderEffect::reconfigure(ReconfigureFlags flags)
 
     m_settings = Breeze::SettingsProvider::self()->defaultSettings();
 
+    updateWindowSettings();
+
     /*m_alpha = int(conf.readEntry("OutlineStrength", 15));
     m_outline = conf.readEntry("DrawOutline", true);
     m_darkTheme = conf.readEntry("DarkThemeOutline", false);
@@ -528,11 +579,9 @@ CornersShaderEffect::prePaintWindow(EffectWindow *w, WindowPrePaintData &data, s
         }
     }
 
-    if (!blur_region.isEmpty() ||
-        w->windowClass().contains("konsole", Qt::CaseInsensitive) ||
-        w->windowClass().contains("yakuake", Qt::CaseInsensitive)) {   
-        if (w->windowClass().contains("konsole", Qt::CaseInsensitive) ||
-            w->windowClass().contains("yakuake", Qt::CaseInsensitive)) {
+    const bool isTerminal = m_windows[w].classFlags & Breeze::WindowClass::Terminal;
+    if (!blur_region.isEmpty() || isTerminal) {
+        if (isTerminal) {
             blur_region = QRegion(0,0,geo.width(),geo.height());    
         }
 
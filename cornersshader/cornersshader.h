@@ -25,6 +25,7 @@
 #include <kwinoffscreeneffect.h>
 
 #include "breezesettingsprovider.h"
+#include "breezewindowclass.h"
 
 namespace KWin {
 
@@ -62,6 +63,7 @@ private:
         bool skipEffect;
         bool isManaged;
         Breeze::InternalSettingsPtr settings;
+        Breeze::WindowClass::Flags classFlags;
         bool hasDecoration = false;
         QVector2D shadowTexSize = QVector2D(0,0);
     };
@@ -80,6 +82,8 @@ private:
     void genRect(EffectScreen *s);
 
     bool isValidWindow(EffectWindow *w, int mask=0);
+    Breeze::InternalSettingsPtr windowSettings(EffectWindow *w) const;
+    void updateWindowSettings();
 
     void fillRegion(const QRegion &reg, const QColor &c);
     //QPainterPath drawSquircle(float size, int translate);
@@ -31,49 +31,28 @@ namespace Breeze
 {
 
     //______________________________________________________________
-    void ExceptionList::readConfig( KSharedConfig::Ptr config )
+    void ExceptionList::readConfig( KSharedConfig::Ptr config, const InternalSettings* defaults )
     {
 
         _exceptions.clear();
 
+        // load default settings once, rather than once per exception
+        InternalSettings loadedDefaults;
+        if( !defaults )
+        {
+            loadedDefaults.load();
+            defaults = &loadedDefaults;
+        }
+
         QString groupName;
         for( int index = 0; config->hasGroup( groupName = exceptionGroupName( index ) ); ++index )
         {
 
-            // create exception
-            InternalSettings exception;
-
-            // reset group
-            readConfig( &exception, config.data(), groupName );
-
-            // create new configuration
-            InternalSettingsPtr configuration( new InternalSettings() );
-            configuration.data()->load();
+            // clone default settings
+            InternalSettingsPtr configuration( createException( *defaults ) );
 
             // apply changes from exception
-            configuration->setEnabled( exception.enabled() );
-            configuration->setExceptionType( exception.exceptionType() );
-            configuration->setExceptionPattern( exception.exceptionPattern() );
-            configuration->setMask( exception.mask() );
-
-            // propagate all features found in mask to the output configuration
-            if( exception.mask() & BorderSize ) configuration->setBorderSize( exception.borderSize() );
-            configuration->setHideTitleBar( exception.hideTitleBar() );
-            configuration->setDrawTitleBarSeparator( exception.drawTitleBarSeparator() );
-            configuration->setOpaqueTitleBar( exception.opaqueTitleBar() );
-            configuration->setOpacityOverride( exception.opacityOverride() );
-            configuration->setDrawBackgroundGradient( exception.drawBackgroundGradient() );
-            configuration->setGradientOverride( exception.gradientOverride() );
-            configuration->setMatchColorForTitleBar( exception.matchColorForTitleBar() );
-            configuration->setIsDialog( exception.isDialog() );
-
-            configuration->setCornerRadius( exception.cornerRadius() );
-            configuration->setApplyCornersShader( exception.applyCornersShader() );
-            configuration->setDrawOutline( exception.drawOutline() );
-            configuration->setDarkThemeOutline( exception.darkThemeOutline() );
-            configuration->setOutlineStrength( exception.outlineStrength() );
-            configuration->setCornersType( exception.cornersType() );
-            configuration->setSquircleRatio( exception.squircleRatio() );
+            readExceptionConfig( configuration.data(), config.data(), groupName );
 
             // append to exceptions
             _exceptions.append( configuration );
@@ -103,28 +82,39 @@ namespace Breeze
 
     }
 
-    //_______________________________________________________________________
-    QString ExceptionList::exceptionGroupName( int index )
-    { return QString( "Windeco Exception %1" ).arg( index ); }
-
     //______________________________________________________________
-    void ExceptionList::writeConfig( KCoreConfigSkeleton* skeleton, KConfig* config, const QString& groupName )
+    InternalSettingsPtr ExceptionList::createException( const InternalSettings& defaults )
     {
+        InternalSettingsPtr exception( new InternalSettings() );
+        const KConfigSkeletonItem::List defaultItems( defaults.items() );
+        const KConfigSkeletonItem::List items( exception->items() );
+        for( int i = 0; i < items.size() && i < defaultItems.size(); ++i )
+        { items[i]->setProperty( defaultItems[i]->property() ); }
 
-        // list of items to be written
-        QStringList keys = { 
-            "Enabled", 
-            "ExceptionPattern", 
-            "ExceptionType", 
-            "HideTitleBar", 
-            "DrawTitleBarSeparator", 
-            "IsDialog", 
-            "OpaqueTitleBar", 
-            "OpacityOverride", 
-            "Mask", 
-            "BorderSize", 
-            "MatchColorForTitleBar", 
-            "DrawBackgroundGradient", 
+        return exception;
+    }
+
+    //_______________________________________________________________________
+    const QStringList& ExceptionList::exceptionKeys()
+    {
+        // mask must come before the keys it enables
+        static const QStringList keys = {
+            "Enabled",
+            "ExceptionPattern",
+            "ExceptionType",
+            "ExceptionWindowRole",
+            "ExceptionDesktopFileName",
+            "ExceptionWindowTypes",
+            "ExceptionTransient",
+            "HideTitleBar",
+            "DrawTitleBarSeparator",
+            "IsDialog",
+            "OpaqueTitleBar",
+            "OpacityOverride",
+            "Mask",
+            "BorderSize",
+            "MatchColorForTitleBar",
+            "DrawBackgroundGradient",
             "GradientOverride",
 
             "CornerRadius",
@@ -136,8 +126,19 @@ namespace Breeze
             "SquircleRatio"
         };
 
+        return keys;
+    }
+
+    //_______________________________________________________________________
+    QString ExceptionList::exceptionGroupName( int index )
+    { return QString( "Windeco Exception %1" ).arg( index ); }
+
+    //______________________________________________________________
+    void ExceptionList::writeConfig( KCoreConfigSkeleton* skeleton, KConfig* config, const QString& groupName )
+    {
+
         // write all items
-        foreach( auto key, keys )
+        foreach( auto key, exceptionKeys() )
         {
             KConfigSkeletonItem* item( skeleton->findItem( key ) );
             if( !item ) continue;
@@ -162,4 +163,29 @@ namespace Breeze
 
     }
 
+    //______________________________________________________________
+    void ExceptionList::readExceptionConfig( KCoreConfigSkeleton* skeleton, KConfig* config, const QString& groupName )
+    {
+
+        int mask = 0;
+        foreach( auto key, exceptionKeys() )
+        {
+            KConfigSkeletonItem* item( skeleton->findItem( key ) );
+            if( !item ) continue;
+
+            // border size is only overridden if enabled in mask
+            if( key == QLatin1String( "BorderSize" ) && !( mask & BorderSize ) ) continue;
+
+            // read from the exception group, leaving the item group unchanged
+            const QString group( item->group() );
+            item->setGroup( groupName );
+            item->readConfig( config );
+            item->setGroup( group );
+
+            if( key == QLatin1String( "Mask" ) ) mask = item->property().toInt();
+
+        }
+
+    }
+
 }
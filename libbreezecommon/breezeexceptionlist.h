@@ -54,11 +54,22 @@ namespace Breeze
         { return _exceptions; }
 
         //! read from KConfig
-        void readConfig( KSharedConfig::Ptr );
+        /*!
+        exceptions are cloned from defaults, which must be already loaded,
+        and only the keys an exception can override are then read.
+        If no defaults are given, they are loaded once from config.
+        */
+        void readConfig( KSharedConfig::Ptr, const InternalSettings* defaults = nullptr );
 
         //! write to kconfig
         void writeConfig( KSharedConfig::Ptr );
 
+        //! keys an exception overrides, in reading order
+        static const QStringList& exceptionKeys();
+
+        //! new exception, with all settings copied from defaults
+        static InternalSettingsPtr createException( const InternalSettings& defaults );
+
         protected:
 
         //! generate exception group name for given exception index
@@ -67,6 +78,9 @@ namespace Breeze
         //! read configuration
         static void readConfig( KCoreConfigSkeleton*, KConfig*, const QString& );
 
+        //! read only exception keys from given group
+        static void readExceptionConfig( KCoreConfigSkeleton*, KConfig*, const QString& );
+
         //! write configuration
         static void writeConfig( KCoreConfigSkeleton*, KConfig*, const QString& );
 
@@ -0,0 +1,356 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezeexceptionmatcher.h"
+
+
+#include <algorithm>
+
+namespace Breeze
+{
+
+    //__________________________________________________________________
+    bool ExceptionMatcher::add( Field field, const QString& pattern, QString* errorString )
+    {
+
+        QString literal;
+        const Kind kind( classify( pattern, literal ) );
+        FieldIndex& index( m_fields[field] );
+
+        switch( kind )
+        {
+            case Exact: index.exact[literal].append( m_size ); break;
+            case Prefix: index.prefixes.insert( literal, m_size ); break;
+            case Substring: index.substrings.insert( literal, m_size ); break;
+
+            default:
+            case Complex:
+            {
+                // the match limit bounds backtracking by steps, not time, so that a value always gets the same result
+                QRegularExpression expression( QStringLiteral( "(*LIMIT_MATCH=%1)" ).arg( int( MatchLimit ) ) + pattern );
+                if( !expression.isValid() )
+                {
+                    if( errorString ) *errorString = QRegularExpression( pattern ).errorString();
+                    return false;
+                }
+
+                expression.optimize();
+                m_complexRules.append( { m_size, field, expression } );
+                break;
+            }
+        }
+
+        ++index.rules;
+        ++m_size;
+        return true;
+
+    }
+
+    //__________________________________________________________________
+    void ExceptionMatcher::finalize()
+    {
+        for( FieldIndex& index : m_fields )
+        { index.substrings.finalize(); }
+    }
+
+    //__________________________________________________________________
+    void ExceptionMatcher::clear()
+    {
+        for( FieldIndex& index : m_fields )
+        { index = FieldIndex(); }
+
+        m_complexRules.clear();
+        m_size = 0;
+    }
+
+    //__________________________________________________________________
+    int ExceptionMatcher::match( const QString& className, const QString& windowTitle, const std::function<bool(int)>& accept ) const
+    {
+
+        const QString* values[FieldCount] = { &className, &windowTitle };
+
+        // rules matched through the indexes
+        QVector<int> candidates;
+        for( int field = 0; field < FieldCount; ++field )
+        {
+            const FieldIndex& index( m_fields[field] );
+            if( !index.rules ) continue;
+
+            const QString& value( *values[field] );
+            const auto iter( index.exact.constFind( value ) );
+            if( iter != index.exact.constEnd() ) candidates += iter.value();
+
+            index.prefixes.collectPrefixes( value, candidates );
+            index.substrings.collectSubstrings( value, candidates );
+        }
+
+        std::sort( candidates.begin(), candidates.end() );
+
+        int best = -1;
+        foreach( int rule, candidates )
+        {
+            if( accept( rule ) )
+            {
+                best = rule;
+                break;
+            }
+        }
+
+        // complex rules are only tried if they come before the best indexed match
+        for( const ComplexRule& complexRule : m_complexRules )
+        {
+            if( best >= 0 && complexRule.rule > best ) break;
+
+            // rules rejected by the caller are not worth a regular expression match
+            if( !accept( complexRule.rule ) ) continue;
+
+            // values that exceed the match limit do not match
+            if( complexRule.expression.match( *values[complexRule.field] ).hasMatch() ) return complexRule.rule;
+        }
+
+        return best;
+
+    }
+
+    //__________________________________________________________________
+    ExceptionMatcher::Cost ExceptionMatcher::estimateCost( const QString& pattern, Construct* construct )
+    {
+
+        // limits above which a pattern is considered moderately expensive
+        static const int maxAlternatives = 64;
+        static const int maxLength = 1024;
+
+        Construct found( NoConstruct );
+
+        // one entry per open group: true if it contains a quantifier
+        QVector<bool> groups;
+        int alternatives = 0;
+
+        auto isQuantifier = []( QChar character )
+        { return character == QLatin1Char( '*' ) || character == QLatin1Char( '+' ) || character == QLatin1Char( '{' ); };
+
+        for( int i = 0; i < pattern.size() && found != NestedQuantifiers; ++i )
+        {
+            const QChar character( pattern.at( i ) );
+            if( character == QLatin1Char( '\\' ) )
+            {
+                if( i + 1 < pattern.size() && pattern.at( i + 1 ).isDigit() && pattern.at( i + 1 ) != QLatin1Char( '0' ) )
+                { found = BackReference; }
+
+                ++i;
+
+            } else if( character == QLatin1Char( '[' ) ) {
+
+                // skip character class
+                for( ++i; i < pattern.size() && pattern.at( i ) != QLatin1Char( ']' ); ++i )
+                { if( pattern.at( i ) == QLatin1Char( '\\' ) ) ++i; }
+
+            } else if( character == QLatin1Char( '(' ) ) {
+
+                groups.append( false );
+
+            } else if( character == QLatin1Char( ')' ) ) {
+
+                const bool lastGroupQuantified( !groups.isEmpty() && groups.takeLast() );
+
+                // quantified group that itself contains a quantifier
+                if( i + 1 < pattern.size() && isQuantifier( pattern.at( i + 1 ) ) )
+                {
+                    if( lastGroupQuantified ) found = NestedQuantifiers;
+                    else if( !groups.isEmpty() ) groups.last() = true;
+                }
+
+                // the quantifier of a group also quantifies its parent
+                if( lastGroupQuantified && !groups.isEmpty() ) groups.last() = true;
+
+            } else if( isQuantifier( character ) ) {
+
+                if( !groups.isEmpty() ) groups.last() = true;
+
+            } else if( character == QLatin1Char( '|' ) ) {
+
+                ++alternatives;
+
+            }
+        }
+
+        if( found == NoConstruct && alternatives > maxAlternatives ) found = LargeAlternation;
+        if( found == NoConstruct && pattern.size() > maxLength ) found = LongPattern;
+
+        if( construct ) *construct = found;
+        switch( found )
+        {
+            case NestedQuantifiers:
+            case BackReference:
+            return Expensive;
+
+            case LargeAlternation:
+            case LongPattern:
+            return Moderate;
+
+            default:
+            case NoConstruct:
+            return Cheap;
+        }
+
+    }
+
+    //__________________________________________________________________
+    ExceptionMatcher::Kind ExceptionMatcher::classify( const QString& pattern, QString& literal )
+    {
+
+        literal.clear();
+
+        int begin = 0;
+        int end = pattern.size();
+
+        const bool anchoredBegin( pattern.startsWith( QLatin1Char( '^' ) ) );
+        if( anchoredBegin ) ++begin;
+
+        // a trailing '$' is an anchor unless it is escaped
+        bool anchoredEnd( false );
+        if( end > begin && pattern.at( end - 1 ) == QLatin1Char( '$' ) )
+        {
+            int backslashes = 0;
+            for( int i = end - 2; i >= begin && pattern.at( i ) == QLatin1Char( '\\' ); --i ) ++backslashes;
+            if( backslashes%2 == 0 )
+            {
+                anchoredEnd = true;
+                --end;
+            }
+        }
+
+        static const QString specialCharacters( QStringLiteral( ".|?*+()[]{}^$" ) );
+        for( int i = begin; i < end; ++i )
+        {
+            const QChar character( pattern.at( i ) );
+            if( character == QLatin1Char( '\\' ) )
+            {
+                // escaped punctuation is literal, escaped letters and digits are classes, anchors or back references
+                if( i + 1 >= end ) return Complex;
+                const QChar escaped( pattern.at( ++i ) );
+                if( escaped.isLetterOrNumber() || escaped.unicode() > 127 ) return Complex;
+                literal.append( escaped );
+
+            } else if( specialCharacters.contains( character ) ) {
+
+                return Complex;
+
+            } else literal.append( character );
+        }
+
+        if( anchoredBegin && anchoredEnd ) return Exact;
+        else if( anchoredBegin ) return Prefix;
+        else if( pattern.isEmpty() ) return Prefix;
+        else if( anchoredEnd || literal.isEmpty() ) return Complex;
+        else return Substring;
+
+    }
+
+    //__________________________________________________________________
+    ExceptionMatcher::Trie::Trie():
+        m_nodes( 1 )
+    {}
+
+    //__________________________________________________________________
+    void ExceptionMatcher::Trie::insert( const QString& literal, int rule )
+    {
+        int node = 0;
+        foreach( const QChar& character, literal )
+        {
+            int next = m_nodes[node].next.value( character, -1 );
+            if( next < 0 )
+            {
+                next = m_nodes.size();
+                m_nodes[node].next.insert( character, next );
+                m_nodes.append( Node() );
+            }
+
+            node = next;
+        }
+
+        m_nodes[node].rules.append( rule );
+    }
+
+    //__________________________________________________________________
+    void ExceptionMatcher::Trie::finalize()
+    {
+
+        // breadth first, so that failure links always point to already processed nodes
+        QVector<int> queue;
+        for( auto iter = m_nodes[0].next.constBegin(); iter != m_nodes[0].next.constEnd(); ++iter )
+        {
+            m_nodes[iter.value()].fail = 0;
+            m_nodes[iter.value()].output = -1;
+            queue.append( iter.value() );
+        }
+
+        for( int i = 0; i < queue.size(); ++i )
+        {
+            const int node = queue[i];
+            for( auto iter = m_nodes[node].next.constBegin(); iter != m_nodes[node].next.constEnd(); ++iter )
+            {
+                const QChar character( iter.key() );
+                const int child( iter.value() );
+
+                // longest proper suffix of the child that is also in the trie
+                int fail = m_nodes[node].fail;
+                while( fail > 0 && !m_nodes[fail].next.contains( character ) ) fail = m_nodes[fail].fail;
+                fail = m_nodes[fail].next.value( character, 0 );
+
+                m_nodes[child].fail = fail;
+                m_nodes[child].output = m_nodes[fail].rules.isEmpty() ? m_nodes[fail].output : fail;
+                queue.append( child );
+            }
+        }
+
+    }
+
+    //__________________________________________________________________
+    void ExceptionMatcher::Trie::collectPrefixes( const QString& value, QVector<int>& rules ) const
+    {
+        int node = 0;
+        rules += m_nodes[node].rules;
+        foreach( const QChar& character, value )
+        {
+            node = m_nodes[node].next.value( character, -1 );
+            if( node < 0 ) return;
+            rules += m_nodes[node].rules;
+        }
+    }
+
+    //__________________________________________________________________
+    void ExceptionMatcher::Trie::collectSubstrings( const QString& value, QVector<int>& rules ) const
+    {
+        if( m_nodes.size() == 1 ) return;
+
+        int node = 0;
+        foreach( const QChar& character, value )
+        {
+            while( node > 0 && !m_nodes[node].next.contains( character ) ) node = m_nodes[node].fail;
+            node = m_nodes[node].next.value( character, 0 );
+
+            // literals ending here
+            for( int output = m_nodes[node].rules.isEmpty() ? m_nodes[node].output : node; output >= 0; output = m_nodes[output].output )
+            { rules += m_nodes[output].rules; }
+        }
+    }
+
+}
@@ -0,0 +1,187 @@
+#ifndef breezeexceptionmatcher_h
+#define breezeexceptionmatcher_h
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// own
+#include "breezecommon_export.h"
+
+#include <QHash>
+#include <QRegularExpression>
+#include <QString>
+#include <QVector>
+
+#include <functional>
+
+namespace Breeze
+{
+
+    //* index of exception patterns, resolving the first matching exception of an ordered list
+    /**
+    patterns are sorted by shape when added:
+    exact literals ("^literal$") go to a hash,
+    anchored prefixes ("^literal") to a trie,
+    unanchored literals to an Aho-Corasick automaton.
+    An empty pattern matches any value, and is stored at the root of the prefix trie.
+    Only the remaining regular expressions are matched one after the other.
+    Rules keep the order in which they were added, and the first matching rule wins.
+    */
+    class BREEZECOMMON_EXPORT ExceptionMatcher
+    {
+
+        public:
+
+        //* value a rule is matched against
+        enum Field
+        {
+            ClassName,
+            WindowTitle,
+            FieldCount
+        };
+
+        //* expected cost of matching a pattern
+        enum Cost
+        {
+            Cheap,
+            Moderate,
+            Expensive
+        };
+
+        //* construct that makes a pattern costly
+        enum Construct
+        {
+            NoConstruct,
+
+            //* quantified group containing a quantifier, as in "(a+)+", prone to catastrophic backtracking
+            NestedQuantifiers,
+
+            //* back reference, which prevents most optimizations
+            BackReference,
+
+            //* many alternatives
+            LargeAlternation,
+
+            //* very long pattern
+            LongPattern
+        };
+
+        //* estimate matching cost from the pattern structure
+        static Cost estimateCost( const QString& pattern, Construct* construct = nullptr );
+
+        //* backtracking steps a regular expression may take on one value. Past it, the rule does not match that value
+        enum { MatchLimit = 100000 };
+
+        //* add a rule. Rules are numbered in the order they are added. Returns false if pattern is not valid
+        bool add( Field, const QString& pattern, QString* errorString = nullptr );
+
+        //* build the automata. Must be called once all rules are added
+        void finalize();
+
+        //* remove all rules
+        void clear();
+
+        //* number of rules
+        int size() const
+        { return m_size; }
+
+        //* true if some rules match against given field
+        bool hasRules( Field field ) const
+        { return m_fields[field].rules > 0; }
+
+        //* index of the first rule matching, and for which accept returns true, or -1
+        int match( const QString& className, const QString& windowTitle, const std::function<bool(int)>& accept ) const;
+
+        private:
+
+        //* pattern shapes
+        enum Kind
+        {
+            Exact,
+            Prefix,
+            Substring,
+            Complex
+        };
+
+        //* find pattern shape, and literal for non complex patterns
+        static Kind classify( const QString& pattern, QString& literal );
+
+        //* character trie, with failure links when used as an Aho-Corasick automaton
+        class Trie
+        {
+            public:
+
+            //* constructor
+            Trie();
+
+            //* insert literal for given rule
+            void insert( const QString&, int rule );
+
+            //* compute failure and output links
+            void finalize();
+
+            //* append rules of all literals that prefix value
+            void collectPrefixes( const QString& value, QVector<int>& rules ) const;
+
+            //* append rules of all literals found in value
+            void collectSubstrings( const QString& value, QVector<int>& rules ) const;
+
+            private:
+
+            struct Node
+            {
+                QHash<QChar, int> next;
+                QVector<int> rules;
+                int fail = 0;
+                int output = -1;
+            };
+
+            QVector<Node> m_nodes;
+
+        };
+
+        //* rules matched against one field
+        struct FieldIndex
+        {
+            QHash<QString, QVector<int>> exact;
+            Trie prefixes;
+            Trie substrings;
+            int rules = 0;
+        };
+
+        //* regular expression that could not be indexed
+        struct ComplexRule
+        {
+            int rule;
+            Field field;
+            QRegularExpression expression;
+        };
+
+        FieldIndex m_fields[FieldCount];
+
+        //* complex rules, in rule order
+        QVector<ComplexRule> m_complexRules;
+
+        int m_size = 0;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,219 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezesettingscache.h"
+
+#include "breezeexceptionlist.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+namespace Breeze
+{
+
+    namespace
+    {
+
+        //* header preceding the payload
+        struct Header
+        {
+            quint32 magic = 0;
+            quint32 version = 0;
+            quint64 cascadeKey = 0;
+            quint32 payloadSize = 0;
+            quint16 checksum = 0;
+        };
+
+        //* serialized header size
+        const int HeaderSize = 4 + 4 + 8 + 4 + 2;
+
+        //* stream settings are written with, fixed so that the format does not depend on the Qt version
+        const int StreamVersion = QDataStream::Qt_5_0;
+
+    }
+
+    //__________________________________________________________________
+    QString SettingsCache::fileName()
+    { return QStandardPaths::writableLocation( QStandardPaths::GenericCacheLocation ) + QStringLiteral( "/roundedsbe/settings.cache" ); }
+
+    //__________________________________________________________________
+    QString SettingsCache::configFileName()
+    { return QStandardPaths::writableLocation( QStandardPaths::GenericConfigLocation ) + QStringLiteral( "/roundedsbe.conf" ); }
+
+    //__________________________________________________________________
+    quint64 SettingsCache::cascadeKey()
+    {
+
+        // user file first, then system wide files, as KConfig merges them.
+        // Files are only stat'ed: reading them would defeat the purpose of the snapshot
+        QCryptographicHash hash( QCryptographicHash::Sha1 );
+        foreach( const QString& path, QStandardPaths::locateAll( QStandardPaths::GenericConfigLocation, QStringLiteral( "roundedsbe.conf" ) ) )
+        {
+            const QFileInfo info( path );
+            QByteArray entry;
+            {
+                QDataStream stream( &entry, QIODevice::WriteOnly );
+                stream.setVersion( StreamVersion );
+                stream << info.absoluteFilePath() << qint64( info.size() ) << qint64( info.lastModified().toMSecsSinceEpoch() );
+            }
+
+            hash.addData( entry );
+        }
+
+        quint64 key( 0 );
+        QDataStream stream( hash.result() );
+        stream >> key;
+        return key;
+
+    }
+
+    //__________________________________________________________________
+    bool SettingsCache::write( const InternalSettings& defaults, const InternalSettingsList& exceptions )
+    {
+
+        const QFileInfo configInfo( configFileName() );
+        if( !configInfo.exists() ) return false;
+
+        // payload
+        QByteArray payload;
+        {
+            QDataStream stream( &payload, QIODevice::WriteOnly );
+            stream.setVersion( StreamVersion );
+
+            // default settings, all items
+            const KConfigSkeletonItem::List items( defaults.items() );
+            stream << quint32( items.size() );
+            foreach( const KConfigSkeletonItem* item, items )
+            { stream << item->name() << item->property(); }
+
+            // exceptions, overridden keys only
+            stream << quint32( exceptions.size() );
+            foreach( const InternalSettingsPtr& exception, exceptions )
+            {
+                QList<const KConfigSkeletonItem*> exceptionItems;
+                foreach( auto key, ExceptionList::exceptionKeys() )
+                {
+                    // border size is only overridden if enabled in mask
+                    if( key == QLatin1String( "BorderSize" ) && !( exception->mask() & BorderSize ) ) continue;
+                    if( const KConfigSkeletonItem* item = exception->findItem( key ) ) exceptionItems.append( item );
+                }
+
+                stream << quint32( exceptionItems.size() );
+                foreach( const KConfigSkeletonItem* item, exceptionItems )
+                { stream << item->name() << item->property(); }
+            }
+        }
+
+        QDir().mkpath( QFileInfo( fileName() ).absolutePath() );
+        QSaveFile file( fileName() );
+        if( !file.open( QIODevice::WriteOnly ) ) return false;
+
+        QDataStream stream( &file );
+        stream.setVersion( StreamVersion );
+        stream
+            << quint32( Magic )
+            << quint32( Version )
+            << quint64( cascadeKey() )
+            << quint32( payload.size() )
+            << quint16( qChecksum( payload.constData(), payload.size() ) );
+        stream.writeRawData( payload.constData(), payload.size() );
+
+        return stream.status() == QDataStream::Ok && file.commit();
+
+    }
+
+    //__________________________________________________________________
+    bool SettingsCache::read( InternalSettings& defaults, InternalSettingsList& exceptions )
+    {
+
+        QFile file( fileName() );
+        if( file.size() < HeaderSize || !file.open( QIODevice::ReadOnly ) ) return false;
+
+        // map rather than read, the file is only looked at once
+        const uchar* data( file.map( 0, file.size() ) );
+        if( !data ) return false;
+
+        const QByteArray bytes( QByteArray::fromRawData( reinterpret_cast<const char*>( data ), file.size() ) );
+
+        // header
+        Header header;
+        {
+            QDataStream stream( bytes.left( HeaderSize ) );
+            stream.setVersion( StreamVersion );
+            stream >> header.magic >> header.version >> header.cascadeKey >> header.payloadSize >> header.checksum;
+            if( stream.status() != QDataStream::Ok ) return false;
+        }
+
+        if( header.magic != Magic || header.version != Version ) return false;
+
+        // stale if any configuration file changed, appeared or disappeared since the snapshot was written
+        if( !QFileInfo::exists( configFileName() ) || cascadeKey() != header.cascadeKey ) return false;
+
+        if( bytes.size() - HeaderSize != qint64( header.payloadSize ) ) return false;
+        const QByteArray payload( QByteArray::fromRawData( bytes.constData() + HeaderSize, header.payloadSize ) );
+        if( qChecksum( payload.constData(), payload.size() ) != header.checksum ) return false;
+
+        QDataStream stream( payload );
+        stream.setVersion( StreamVersion );
+
+        // default settings
+        quint32 count( 0 );
+        stream >> count;
+        for( quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i )
+        {
+            QString name;
+            QVariant value;
+            stream >> name >> value;
+            if( KConfigSkeletonItem* item = defaults.findItem( name ) ) item->setProperty( value );
+        }
+
+        // exceptions
+        InternalSettingsList readExceptions;
+        stream >> count;
+        for( quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i )
+        {
+            InternalSettingsPtr exception( ExceptionList::createException( defaults ) );
+
+            quint32 itemCount( 0 );
+            stream >> itemCount;
+            for( quint32 j = 0; j < itemCount && stream.status() == QDataStream::Ok; ++j )
+            {
+                QString name;
+                QVariant value;
+                stream >> name >> value;
+                if( KConfigSkeletonItem* item = exception->findItem( name ) ) item->setProperty( value );
+            }
+
+            readExceptions.append( exception );
+        }
+
+        if( stream.status() != QDataStream::Ok ) return false;
+
+        exceptions = readExceptions;
+        return true;
+
+    }
+
+}
@@ -0,0 +1,76 @@
+#ifndef breezesettingscache_h
+#define breezesettingscache_h
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// own
+#include "breezecommon_export.h"
+
+#include "breezesettings.h"
+#include "breeze.h"
+
+#include <QString>
+
+namespace Breeze
+{
+
+    //* compact binary snapshot of default settings and exceptions
+    /**
+    it is written by the configuration module each time settings are saved,
+    and read by the decoration at startup instead of parsing the configuration file.
+    The snapshot is versioned and checksummed, and records a key computed from the path,
+    size and modification time of every configuration file in the cascade it was written from,
+    including system wide files such as /etc/xdg/roundedsbe.conf. It is ignored if the key does not match.
+    */
+    class BREEZECOMMON_EXPORT SettingsCache
+    {
+
+        public:
+
+        //* write snapshot. Must be called once the configuration file is synced
+        static bool write( const InternalSettings& defaults, const InternalSettingsList& exceptions );
+
+        //* read snapshot into defaults, and exceptions cloned from them
+        /** returns false if the snapshot is missing, corrupted or out of date */
+        static bool read( InternalSettings& defaults, InternalSettingsList& exceptions );
+
+        //* snapshot file
+        static QString fileName();
+
+        //* configuration file the snapshot is written from
+        static QString configFileName();
+
+        private:
+
+        //* key identifying the current state of all configuration files in the cascade
+        static quint64 cascadeKey();
+
+        //* file identification
+        enum
+        {
+            Magic = 0x52534245,
+            Version = 2
+        };
+
+    };
+
+}
+
+#endif
@@ -21,6 +21,8 @@
 #include "breezesettingsprovider.h"
 
 #include "breezeexceptionlist.h"
+#include "breezesettingscache.h"
+#include "breezewindowclass.h"
 
 #include <KDecoration2/DecoratedClient>
 #include <KDecoration2/DecorationButtonGroup>
@@ -29,128 +31,607 @@
 
 #include <KWindowInfo>
 
-#include <QRegularExpression>
+#include <QDataStream>
+#include <QDebug>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QMultiHash>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QTimer>
 #include <QTextStream>
 
+#include <functional>
+
 namespace Breeze
 {
 
-    SettingsProvider *SettingsProvider::s_self = nullptr;
+    QAtomicPointer<SettingsProvider> SettingsProvider::s_self;
+
+    namespace
+    {
+        //* guards singleton creation
+        QBasicMutex s_selfMutex;
+
+        //* runs a function on a pool thread
+        class Task: public QRunnable
+        {
+            public:
+
+            //* constructor
+            explicit Task( std::function<void()> function ):
+                m_function( std::move( function ) )
+            {}
+
+            //* run
+            void run() override
+            { m_function(); }
+
+            private:
+
+            //* function
+            std::function<void()> m_function;
+        };
+
+    }
 
     //__________________________________________________________________
     SettingsProvider::SettingsProvider():
         m_config( KSharedConfig::openConfig( QStringLiteral("roundedsbe.conf") ) )
-    { reconfigure(); }
+    {
+        reconfigure();
+
+        // reload when the configuration file is edited directly, once writes settle
+        m_reloadTimer = new QTimer( this );
+        m_reloadTimer->setSingleShot( true );
+        m_reloadTimer->setInterval( ReloadDelay );
+        connect( m_reloadTimer, &QTimer::timeout, this, &SettingsProvider::reconfigure );
+
+        // only the file is watched. Watching its directory would wake up on any change to ~/.config
+        m_watcher = new QFileSystemWatcher( this );
+        const QString fileName( SettingsCache::configFileName() );
+        const QFileInfo info( fileName );
+        if( info.exists() )
+        {
+            m_watcher->addPath( fileName );
+            m_configModified = info.lastModified();
+        }
+
+        connect( m_watcher, &QFileSystemWatcher::fileChanged, this, &SettingsProvider::configFileChanged );
+
+        // retry watching the file while an atomic save is replacing it
+        m_watchTimer = new QTimer( this );
+        m_watchTimer->setSingleShot( true );
+        m_watchTimer->setInterval( WatchRetryDelay );
+        connect( m_watchTimer, &QTimer::timeout, this, &SettingsProvider::watchConfigFile );
+
+        // a single thread is enough, requests only wait for the server round-trip
+        m_windowPropertiesPool = new QThreadPool( this );
+        m_windowPropertiesPool->setMaxThreadCount( 1 );
+    }
+
+    //__________________________________________________________________
+    void SettingsProvider::configFileChanged()
+    {
+        const QString fileName( SettingsCache::configFileName() );
+
+        // files replaced by an atomic save are no longer watched
+        if( !m_watcher->files().contains( fileName ) )
+        {
+            m_watchAttempts = 0;
+            watchConfigFile();
+        }
+
+        const QFileInfo info( fileName );
+        const QDateTime modified( info.exists() ? info.lastModified() : QDateTime() );
+        if( modified == m_configModified ) return;
+        m_configModified = modified;
+
+        m_reloadTimer->start();
+    }
+
+    //__________________________________________________________________
+    void SettingsProvider::watchConfigFile()
+    {
+        const QString fileName( SettingsCache::configFileName() );
+        if( m_watcher->files().contains( fileName ) ) return;
+
+        // the new file may not be renamed in place yet
+        if( !m_watcher->addPath( fileName ) )
+        {
+            if( ++m_watchAttempts < MaxWatchAttempts ) m_watchTimer->start();
+            return;
+        }
+
+        // the file may have been written before it was watched again
+        if( m_watchTimer->isActive() ) m_watchTimer->stop();
+        configFileChanged();
+    }
 
     //__________________________________________________________________
     SettingsProvider::~SettingsProvider()
-    { s_self = nullptr; }
+    {
+        // pending reads post their result back to this object
+        m_windowPropertiesPool->waitForDone();
+        s_self.storeRelease( nullptr );
+    }
 
     //__________________________________________________________________
     SettingsProvider *SettingsProvider::self()
     {
-        // TODO: this is not thread safe!
-        if (!s_self)
-        { s_self = new SettingsProvider(); }
+        SettingsProvider* provider( s_self.loadAcquire() );
+        if( provider ) return provider;
+
+        QMutexLocker locker( &s_selfMutex );
+        provider = s_self.loadAcquire();
+        if( !provider )
+        {
+            provider = new SettingsProvider();
+            s_self.storeRelease( provider );
+        }
 
-        return s_self;
+        return provider;
     }
 
     //__________________________________________________________________
     void SettingsProvider::reconfigure()
     {
-        if( !m_defaultSettings )
+
+        // the configuration module may have created the file since it was last watched
+        if( m_watcher && !m_watcher->files().contains( SettingsCache::configFileName() ) && m_watcher->addPath( SettingsCache::configFileName() ) )
+        { m_configModified = QFileInfo( SettingsCache::configFileName() ).lastModified(); }
+
+        QMutexLocker locker( &m_reconfigureMutex );
+
+        // the next snapshot is built off to the side, readers keep using the current one
+        std::shared_ptr<Snapshot> next( std::make_shared<Snapshot>() );
+
+        next->defaultSettings = InternalSettingsPtr( new InternalSettings() );
+        next->defaultSettings->setCurrentGroup( QStringLiteral("Windeco") );
+
+        // use the binary snapshot written by the configuration module, unless missing or stale
+        InternalSettingsList exceptions;
+        if( !SettingsCache::read( *next->defaultSettings, exceptions ) )
+        {
+            next->defaultSettings->load();
+
+            ExceptionList exceptionList;
+            exceptionList.readConfig( m_config, next->defaultSettings.data() );
+            exceptions = exceptionList.get();
+        }
+
+        // discard disabled exceptions and exceptions that would match any window
+        foreach( auto exception, exceptions )
+        {
+            if( exception->enabled() && ( !exception->exceptionPattern().isEmpty() || criteria( *exception ) ) )
+            { next->loadedExceptions.append( exception ); }
+        }
+
+        // find what changed since last reconfigure
+        const SnapshotPtr current( snapshot() );
+        if( current )
         {
-            m_defaultSettings = InternalSettingsPtr(new InternalSettings());
-            m_defaultSettings->setCurrentGroup( QStringLiteral("Windeco") );
+            next->changes = diff( *current->defaultSettings, *next->defaultSettings );
+
+            // unchanged settings keep their object, so that decorations can tell they are not affected
+            const bool defaultsChanged( next->changes );
+            if( !defaultsChanged ) next->defaultSettings = current->defaultSettings;
+
+            QVector<QByteArray> previousSignatures;
+            QMultiHash<QByteArray, InternalSettingsPtr> previous;
+            foreach( auto exception, current->loadedExceptions )
+            {
+                previousSignatures.append( signature( *exception ) );
+                previous.insert( previousSignatures.last(), exception );
+            }
+
+            bool exceptionsChanged( previousSignatures.size() != next->loadedExceptions.size() );
+            for( int i = 0; i < next->loadedExceptions.size(); ++i )
+            {
+                const QByteArray key( signature( *next->loadedExceptions[i] ) );
+
+                // exceptions reordered, with the same content, still change which one matches first
+                if( !exceptionsChanged && key != previousSignatures[i] ) exceptionsChanged = true;
+
+                const auto iter( previous.find( key ) );
+                if( iter == previous.end() ) continue;
+
+                if( !defaultsChanged ) next->loadedExceptions[i] = iter.value();
+                previous.erase( iter );
+            }
+
+            if( exceptionsChanged ) next->changes |= ExceptionsChanged;
+
+            // keep current snapshot, and resolved settings, if nothing changed
+            if( !next->changes ) return;
+        }
+
+        // index patterns once, lookups only run the matcher
+        foreach( auto exception, next->loadedExceptions )
+        {
+
+            const ExceptionMatcher::Field field( exception->exceptionType() == InternalSettings::ExceptionWindowTitle ?
+                ExceptionMatcher::WindowTitle : ExceptionMatcher::ClassName );
+
+            QString errorString;
+            if( !next->matcher.add( field, exception->exceptionPattern(), &errorString ) )
+            {
+                qWarning() << "SettingsProvider::reconfigure - ignoring exception with invalid pattern" << exception->exceptionPattern() << ":" << errorString;
+                continue;
+            }
+
+            // accepted, but reported. Values that exceed the match limit are not matched
+            if( ExceptionMatcher::estimateCost( exception->exceptionPattern() ) == ExceptionMatcher::Expensive )
+            { qWarning() << "SettingsProvider::reconfigure - exception pattern" << exception->exceptionPattern() << "is prone to slow matching"; }
+
+            next->exceptions.append( exception );
+            if( exception->isDialog() ) next->hasDialogExceptions = true;
+
         }
 
-        m_defaultSettings->load();
+        next->matcher.finalize();
+        next->criteria.build( next->exceptions );
 
-        ExceptionList exceptions;
-        exceptions.readConfig( m_config );
-        m_exceptions = exceptions.get();
+        // publish
+        const Changes changes( next->changes );
+        next->generation = current ? current->generation + 1 : 1;
+        m_snapshot.store( SnapshotPtr( std::move( next ) ), std::memory_order_release );
+        locker.unlock();
+
+        emit changed( changes );
 
     }
 
     //__________________________________________________________________
-    InternalSettingsPtr SettingsProvider::defaultSettings() const
+    SettingsProvider::Changes SettingsProvider::diff( const InternalSettings& previous, const InternalSettings& current )
     {
-        return m_defaultSettings;
+
+        // keys that do not need a full reconfiguration. Any other key is assumed to change geometry
+        static const QHash<QString, Change> categories = {
+            { QStringLiteral( "ShadowSize" ), ShadowChanged },
+            { QStringLiteral( "ShadowStrength" ), ShadowChanged },
+            { QStringLiteral( "ShadowColor" ), ShadowChanged },
+            { QStringLiteral( "SpecificShadowsInactiveWindows" ), ShadowChanged },
+            { QStringLiteral( "ShadowSizeInactiveWindows" ), ShadowChanged },
+            { QStringLiteral( "ShadowStrengthInactiveWindows" ), ShadowChanged },
+            { QStringLiteral( "ShadowColorInactiveWindows" ), ShadowChanged },
+
+            { QStringLiteral( "TitleAlignment" ), ColorsChanged },
+            { QStringLiteral( "MatchColorForTitleBar" ), ColorsChanged },
+            { QStringLiteral( "SystemForegroundColor" ), ColorsChanged },
+            { QStringLiteral( "UnisonHovering" ), ColorsChanged },
+            { QStringLiteral( "DrawOutline" ), ColorsChanged },
+            { QStringLiteral( "DarkThemeOutline" ), ColorsChanged },
+            { QStringLiteral( "OutlineStrength" ), ColorsChanged },
+            { QStringLiteral( "DrawBackgroundGradient" ), ColorsChanged },
+            { QStringLiteral( "BackgroundGradientIntensity" ), ColorsChanged },
+            { QStringLiteral( "GradientOverride" ), ColorsChanged },
+            { QStringLiteral( "DrawTitleBarSeparator" ), ColorsChanged },
+            { QStringLiteral( "OpaqueTitleBar" ), ColorsChanged },
+            { QStringLiteral( "BackgroundOpacity" ), ColorsChanged },
+            { QStringLiteral( "OpacityOverride" ), ColorsChanged },
+
+            { QStringLiteral( "AnimationsEnabled" ), AnimationsChanged },
+            { QStringLiteral( "AnimationsDuration" ), AnimationsChanged },
+
+            // exception only keys, unused in default settings
+            { QStringLiteral( "IsDialog" ), NoChange },
+            { QStringLiteral( "ExceptionType" ), NoChange },
+            { QStringLiteral( "ExceptionPattern" ), NoChange },
+            { QStringLiteral( "ExceptionWindowRole" ), NoChange },
+            { QStringLiteral( "ExceptionDesktopFileName" ), NoChange },
+            { QStringLiteral( "ExceptionWindowTypes" ), NoChange },
+            { QStringLiteral( "ExceptionTransient" ), NoChange },
+            { QStringLiteral( "Enabled" ), NoChange },
+            { QStringLiteral( "Mask" ), NoChange }
+        };
+
+        Changes changes;
+        const KConfigSkeletonItem::List previousItems( previous.items() );
+        const KConfigSkeletonItem::List currentItems( current.items() );
+        if( previousItems.size() != currentItems.size() ) return AllChanged;
+
+        for( int i = 0; i < currentItems.size(); ++i )
+        {
+            if( previousItems[i]->property() != currentItems[i]->property() )
+            { changes |= categories.value( currentItems[i]->name(), GeometryChanged ); }
+        }
+
+        return changes;
+
     }
 
     //__________________________________________________________________
-    InternalSettingsPtr SettingsProvider::internalSettings( KDecoration2::Decoration *decoration ) const
+    QByteArray SettingsProvider::signature( const InternalSettings& exception )
     {
-        QString className;
 
-        // get the client
-        const auto client = decoration->client().toStrongRef();
-        if( className.isEmpty() )
+        QByteArray signature;
+        QDataStream stream( &signature, QIODevice::WriteOnly );
+        foreach( auto key, ExceptionList::exceptionKeys() )
         {
-            // retrieve class name
-            KWindowInfo info( client->windowId(), {}, NET::WM2WindowClass );
-            QString window_className( QString::fromUtf8(info.windowClassName()) );
-            QString window_class( QString::fromUtf8(info.windowClassClass()) );
-            className = window_className + QStringLiteral(" ") + window_class;
+            if( const KConfigSkeletonItem* item = exception.findItem( key ) )
+            { stream << item->property(); }
         }
 
-        return internalSettings( className, client->caption(), client->windowId() );
+        return signature;
+
     }
 
     //__________________________________________________________________
-    InternalSettingsPtr SettingsProvider::internalSettings( QString className, QString caption, WId windowId ) const
+    int SettingsProvider::criteria( const InternalSettings& exception )
     {
+        int criteria = 0;
+        if( !exception.exceptionWindowRole().isEmpty() ) criteria |= RoleCriterion;
+        if( !exception.exceptionDesktopFileName().isEmpty() ) criteria |= DesktopFileNameCriterion;
+        if( exception.exceptionWindowTypes() ) criteria |= WindowTypeCriterion;
+        if( exception.exceptionTransient() != InternalSettings::TransientAny ) criteria |= TransientCriterion;
+        return criteria;
+    }
 
-        QString windowTitle;
+    //__________________________________________________________________
+    void SettingsProvider::CriteriaIndex::build( const InternalSettingsList& exceptions )
+    {
 
-        foreach( auto internalSettings, m_exceptions )
+        const int count( exceptions.size() );
+        criteria = 0;
+        foreach( auto exception, exceptions )
+        { criteria |= SettingsProvider::criteria( *exception ); }
+
+        // rules using each role and desktop file name
+        QHash<QString, QVector<int>> roleRules;
+        QHash<QString, QVector<int>> desktopFileNameRules;
+
+        anyRole = QBitArray( count, true );
+        anyDesktopFileName = QBitArray( count, true );
+        anyWindowType = QBitArray( count, true );
+        windowTypes.clear();
+        if( criteria & WindowTypeCriterion ) windowTypes.fill( QBitArray( count, true ), 32 );
+        anyTransient = QBitArray( count, true );
+        transient = QBitArray( count, true );
+        notTransient = QBitArray( count, true );
+
+        for( int rule = 0; rule < count; ++rule )
         {
+            const InternalSettings& exception( *exceptions[rule] );
 
-            // discard disabled exceptions
-            if( !internalSettings->enabled() ) continue;
+            if( !exception.exceptionWindowRole().isEmpty() )
+            {
+                anyRole.clearBit( rule );
+                roleRules[exception.exceptionWindowRole()].append( rule );
+            }
 
-            // discard exceptions with empty exception pattern
-            if( internalSettings->exceptionPattern().isEmpty() ) continue;
+            if( !exception.exceptionDesktopFileName().isEmpty() )
+            {
+                anyDesktopFileName.clearBit( rule );
+                desktopFileNameRules[exception.exceptionDesktopFileName()].append( rule );
+            }
 
-            if (internalSettings->isDialog() && windowId != 0)
+            // window types are stored as a NET type mask, with one bit per type
+            if( const uint mask = exception.exceptionWindowTypes() )
             {
-              KWindowInfo info(windowId, NET::WMWindowType);
-              if (info.valid() && info.windowType(NET::NormalMask | NET::DialogMask) != NET::Dialog) {
-                continue;
-              }
+                anyWindowType.clearBit( rule );
+                for( int type = 0; type < windowTypes.size(); ++type )
+                { if( !( mask & ( 1u << type ) ) ) windowTypes[type].clearBit( rule ); }
             }
 
-            /*
-            decide which value is to be compared
-            to the regular expression, based on exception type
-            */
-            QString value;
-            switch( internalSettings->exceptionType() )
+            switch( exception.exceptionTransient() )
             {
-                case InternalSettings::ExceptionWindowTitle:
-                {
-                    value = windowTitle.isEmpty() ? (windowTitle = caption):windowTitle;
-                    break;
-                }
-
-                default:
-                case InternalSettings::ExceptionWindowClassName:
-                {
-                    value = className;
-                    break;
-                }
+                case InternalSettings::TransientOnly:
+                notTransient.clearBit( rule );
+                anyTransient.clearBit( rule );
+                break;
+
+                case InternalSettings::TransientNever:
+                transient.clearBit( rule );
+                anyTransient.clearBit( rule );
+                break;
 
+                default: break;
             }
+        }
+
+        // rules without a value are allowed for any value
+        roles.clear();
+        for( auto iter = roleRules.constBegin(); iter != roleRules.constEnd(); ++iter )
+        {
+            QBitArray& rules( roles[iter.key()] = anyRole );
+            foreach( int rule, iter.value() ) rules.setBit( rule );
+        }
+
+        desktopFileNames.clear();
+        for( auto iter = desktopFileNameRules.constBegin(); iter != desktopFileNameRules.constEnd(); ++iter )
+        {
+            QBitArray& rules( desktopFileNames[iter.key()] = anyDesktopFileName );
+            foreach( int rule, iter.value() ) rules.setBit( rule );
+        }
+
+    }
+
+    //__________________________________________________________________
+    QBitArray SettingsProvider::CriteriaIndex::allowed( const WindowProperties& properties ) const
+    {
+
+        QBitArray allowed;
+        auto restrict = [&allowed]( const QBitArray& rules )
+        {
+            if( allowed.isEmpty() ) allowed = rules;
+            else allowed &= rules;
+        };
+
+        // a criterion on an unknown property never matches: only rules without that criterion are allowed
+        if( criteria & RoleCriterion )
+        {
+            if( properties.known & WindowProperties::KnownRole ) restrict( roles.value( properties.role, anyRole ) );
+            else restrict( anyRole );
+        }
+
+        if( criteria & DesktopFileNameCriterion )
+        {
+            if( properties.known & WindowProperties::KnownDesktopFileName ) restrict( desktopFileNames.value( properties.desktopFileName, anyDesktopFileName ) );
+            else restrict( anyDesktopFileName );
+        }
 
-            // check matching
-            QRegularExpression rx( internalSettings->exceptionPattern() );
-            if( rx.match( value ).hasMatch() )
-            { return internalSettings; }
+        if( criteria & WindowTypeCriterion )
+        {
+            if( properties.windowType >= 0 && properties.windowType < windowTypes.size() ) restrict( windowTypes[properties.windowType] );
+            else restrict( anyWindowType );
+        }
+
+        if( criteria & TransientCriterion )
+        {
+            if( properties.transient == WindowProperties::IsTransient ) restrict( transient );
+            else if( properties.transient == WindowProperties::NotTransient ) restrict( notTransient );
+            else restrict( anyTransient );
+        }
+
+        return allowed;
+
+    }
+
+    //__________________________________________________________________
+    InternalSettingsPtr SettingsProvider::defaultSettings() const
+    {
+        return snapshot()->defaultSettings;
+    }
+
+    //__________________________________________________________________
+    InternalSettingsPtr SettingsProvider::internalSettings( KDecoration2::Decoration *decoration ) const
+    {
+        // get the client
+        const auto client = decoration->client().toStrongRef();
+
+        WindowProperties properties( windowProperties( client->windowId() ) );
+        properties.caption = client->caption();
+        return internalSettings( properties );
+    }
+
+    //__________________________________________________________________
+    InternalSettingsPtr SettingsProvider::internalSettings( const WindowProperties& properties ) const
+    {
+
+        // the snapshot stays alive, and unchanged, for the whole lookup
+        const SnapshotPtr current( snapshot() );
+        if( current->exceptions.isEmpty() ) return current->defaultSettings;
+
+        const MemoKey key = {
+            properties.classId >= 0 ? properties.classId : WindowClass::id( properties.className ),
+            current->matcher.hasRules( ExceptionMatcher::WindowTitle ) ? properties.caption:QString(),
+            current->hasDialogExceptions ? properties.type:WindowProperties::Unknown,
+            ( current->criteria.criteria & WindowTypeCriterion ) ? properties.windowType:-1,
+            ( current->criteria.criteria & TransientCriterion ) ? int( properties.transient ):int( WindowProperties::TransientUnknown ),
+            ( current->criteria.criteria & RoleCriterion ) && ( properties.known & WindowProperties::KnownRole ) ? properties.role:QString(),
+            ( current->criteria.criteria & DesktopFileNameCriterion ) && ( properties.known & WindowProperties::KnownDesktopFileName ) ? properties.desktopFileName:QString() };
+
+        // resolved settings are kept per thread, so that lookups never lock.
+        // They are dropped once a newer snapshot is seen
+        struct Memo
+        {
+            quint64 generation = 0;
+            QHash<MemoKey, InternalSettingsPtr> settings;
+        };
+
+        static thread_local Memo memo;
+        if( memo.generation != current->generation )
+        {
+            memo.settings.clear();
+            memo.generation = current->generation;
+        }
+
+        const auto iter( memo.settings.constFind( key ) );
+        if( iter != memo.settings.constEnd() ) return iter.value();
+
+        // rules excluded by the window criteria, as the intersection of the per criterion indexes
+        const QBitArray allowed( current->criteria.allowed( properties ) );
+
+        // dialog exceptions are skipped only for windows known not to be dialogs
+        const int index = current->matcher.match( properties.className, properties.caption, [&]( int rule )
+        {
+            if( !allowed.isEmpty() && !allowed.testBit( rule ) ) return false;
+            return properties.type != WindowProperties::NotDialog || !current->exceptions[rule]->isDialog();
+        } );
+
+        const InternalSettingsPtr settings( index >= 0 ? current->exceptions[index] : current->defaultSettings );
+
+        if( memo.settings.size() >= MaxMemoSize ) memo.settings.clear();
+        memo.settings.insert( key, settings );
+        return settings;
+
+    }
+
+    //__________________________________________________________________
+    void SettingsProvider::forgetWindow( WId windowId )
+    {
+        QMutexLocker locker( &m_windowPropertiesMutex );
+        m_windowProperties.remove( windowId );
+        m_pendingWindows.remove( windowId );
+    }
+
+    //__________________________________________________________________
+    SettingsProvider::WindowProperties SettingsProvider::windowProperties( WId windowId ) const
+    {
+
+        {
+            QMutexLocker locker( &m_windowPropertiesMutex );
+            const auto iter( m_windowProperties.constFind( windowId ) );
+            if( iter != m_windowProperties.constEnd() ) return iter.value();
+
+            // properties are read once per window. Until then the window only matches rules on its caption
+            if( windowId == 0 || m_pendingWindows.contains( windowId ) ) return WindowProperties();
+            m_pendingWindows.insert( windowId );
+        }
+
+        // read off the main thread, the result is stored, and announced, from the main thread
+        SettingsProvider* provider( const_cast<SettingsProvider*>( this ) );
+        m_windowPropertiesPool->start( new Task( [provider, windowId]()
+        {
+            const WindowProperties properties( readWindowProperties( windowId ) );
+            QMetaObject::invokeMethod( provider, [provider, windowId, properties]()
+            { provider->storeWindowProperties( windowId, properties ); }, Qt::QueuedConnection );
+        } ) );
+
+        return WindowProperties();
+
+    }
+
+    //__________________________________________________________________
+    SettingsProvider::WindowProperties SettingsProvider::readWindowProperties( WId windowId )
+    {
+
+        // all matched properties are fetched together, in a single request.
+        // The xcb connection is thread safe, this runs on a pool thread
+        WindowProperties properties;
+        KWindowInfo info( windowId, NET::WMWindowType, NET::WM2WindowClass | NET::WM2WindowRole | NET::WM2DesktopFileName | NET::WM2TransientFor );
+        properties.classId = WindowClass::id( QString::fromUtf8(info.windowClassName()) + QStringLiteral(" ") + QString::fromUtf8(info.windowClassClass()) );
+
+        // share the interned string between all windows of the same class
+        properties.className = WindowClass::name( properties.classId );
+        if( info.valid() )
+        {
+            properties.type = info.windowType(NET::NormalMask | NET::DialogMask) == NET::Dialog ? WindowProperties::Dialog : WindowProperties::NotDialog;
+            properties.windowType = info.windowType(NET::AllTypesMask);
+            properties.role = QString::fromUtf8( info.windowRole() );
+            properties.desktopFileName = QString::fromUtf8( info.desktopFileName() );
+            properties.transient = info.transientFor() ? WindowProperties::IsTransient : WindowProperties::NotTransient;
+            properties.known = WindowProperties::KnownRole | WindowProperties::KnownDesktopFileName;
+        }
+
+        return properties;
+
+    }
+
+    //__________________________________________________________________
+    void SettingsProvider::storeWindowProperties( WId windowId, const WindowProperties& properties )
+    {
+
+        {
+            QMutexLocker locker( &m_windowPropertiesMutex );
 
+            // the decoration may have been destroyed while reading
+            if( !m_pendingWindows.remove( windowId ) ) return;
+            m_windowProperties.insert( windowId, properties );
         }
 
-        return m_defaultSettings;
+        emit windowPropertiesChanged( windowId );
 
     }
 
@@ -25,11 +25,26 @@
 
 #include <KDecoration2/Decoration>
 #include "breezesettings.h"
+#include "breezeexceptionmatcher.h"
 #include "breeze.h"
 
 #include <KSharedConfig>
 
+#include <QAtomicPointer>
+#include <QBitArray>
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
 #include <QObject>
+#include <QSet>
+#include <QVector>
+
+#include <atomic>
+#include <memory>
+
+class QFileSystemWatcher;
+class QThreadPool;
+class QTimer;
 
 namespace Breeze
 {
@@ -47,38 +62,320 @@ namespace Breeze
         //* singleton
         static SettingsProvider *self();
 
+        //* kind of changes found by reconfigure
+        enum Change
+        {
+            NoChange = 0,
+
+            //* shadow size, strength and color
+            ShadowChanged = 1<<0,
+
+            //* colors, opacity and other settings that only need a repaint
+            ColorsChanged = 1<<1,
+
+            //* animation settings
+            AnimationsChanged = 1<<2,
+
+            //* anything that changes borders, title bar or button layout
+            GeometryChanged = 1<<3,
+
+            //* exception list, which may change the settings of any window
+            ExceptionsChanged = 1<<4,
+
+            AllChanged = ShadowChanged|ColorsChanged|AnimationsChanged|GeometryChanged|ExceptionsChanged
+        };
+
+        Q_DECLARE_FLAGS( Changes, Change )
+
+        //* changes that produced the current settings
+        Changes changes() const
+        { return snapshot()->changes; }
+
         //* default settings
         InternalSettingsPtr defaultSettings() const;
 
+        //* window properties exceptions are matched against
+        struct WindowProperties
+        {
+            //* window class name, as "name class"
+            QString className;
+
+            //* interned window class id, see WindowClass. Computed from className if negative
+            int classId = -1;
+
+            //* window caption
+            QString caption;
+
+            //* window type, restricted to what dialog exceptions need
+            enum Type
+            {
+                Unknown,
+                Dialog,
+                NotDialog
+            };
+
+            Type type = Unknown;
+
+            //* NET window type, or -1 if unknown
+            int windowType = -1;
+
+            //* window role
+            QString role;
+
+            //* desktop file name
+            QString desktopFileName;
+
+            //* transient state
+            enum Transient
+            {
+                TransientUnknown,
+                IsTransient,
+                NotTransient
+            };
+
+            Transient transient = TransientUnknown;
+
+            //* string properties that were actually read. Rules with a criterion on other properties do not match
+            enum KnownProperty
+            {
+                KnownRole = 1<<0,
+                KnownDesktopFileName = 1<<1
+            };
+
+            int known = 0;
+        };
+
         //* internal settings for given decoration
         InternalSettingsPtr internalSettings(KDecoration2::Decoration *) const;
 
-        InternalSettingsPtr internalSettings(QString className, QString caption, WId windowId=0 ) const;
+        //* internal settings for given window properties. Does not query the window system
+        InternalSettingsPtr internalSettings( const WindowProperties& ) const;
+
+        //* true if some exception matches window titles, which then depend on caption changes
+        bool hasTitleExceptions() const
+        { return snapshot()->matcher.hasRules( ExceptionMatcher::WindowTitle ); }
+
+        //* properties of given X11 window, as cached. Starts reading them, and returns unknown properties, on first lookup
+        /** windowPropertiesChanged is emitted once they are read */
+        WindowProperties windowProperties( WId ) const;
+
+        //* discard cached properties of a window, once its decoration is destroyed
+        void forgetWindow( WId );
+
+        Q_SIGNALS:
+
+        //* emitted at the end of reconfigure, if settings actually changed
+        void changed( SettingsProvider::Changes );
+
+        //* emitted once the properties of a window have been read, so that its settings are resolved again
+        void windowPropertiesChanged( WId );
 
         public Q_SLOTS:
 
         //* reconfigure
         void reconfigure();
 
+        private Q_SLOTS:
+
+        //* configuration file changed on disk, or was replaced
+        void configFileChanged();
+
+        //* watch configuration file again, once it is back in place
+        void watchConfigFile();
+
         private:
 
         //* constructor
         SettingsProvider();
 
-        //* default configuration
-        InternalSettingsPtr m_defaultSettings;
+        //* read properties of given window from the window system. Blocks until the server replies
+        static WindowProperties readWindowProperties( WId );
+
+        //* store properties read for given window, unless it was forgotten meanwhile
+        void storeWindowProperties( WId, const WindowProperties& );
+
+        //* changes between two snapshots of the default settings
+        static Changes diff( const InternalSettings&, const InternalSettings& );
+
+        //* values of the keys an exception overrides, to find unchanged exceptions
+        static QByteArray signature( const InternalSettings& );
+
+        //* window criteria exceptions can combine with their pattern
+        enum Criterion
+        {
+            RoleCriterion = 1<<0,
+            DesktopFileNameCriterion = 1<<1,
+            WindowTypeCriterion = 1<<2,
+            TransientCriterion = 1<<3
+        };
+
+        //* criteria used by given exception
+        static int criteria( const InternalSettings& );
 
-        //* exceptions
-        InternalSettingsList m_exceptions;
+        //* rules allowed by each value of the window criteria, one bit per rule
+        struct CriteriaIndex
+        {
+            //* criteria used by some rule
+            int criteria = 0;
+
+            //*@name rules without a role, and rules allowed for each role
+            //@{
+            QBitArray anyRole;
+            QHash<QString, QBitArray> roles;
+            //@}
+
+            //*@name rules without a desktop file name, and rules allowed for each desktop file name
+            //@{
+            QBitArray anyDesktopFileName;
+            QHash<QString, QBitArray> desktopFileNames;
+            //@}
+
+            //*@name rules without window types, and rules allowed for each NET window type
+            //@{
+            QBitArray anyWindowType;
+            QVector<QBitArray> windowTypes;
+            //@}
+
+            //*@name rules without a transient state, and rules allowed for transient and non transient windows
+            //@{
+            QBitArray anyTransient;
+            QBitArray transient;
+            QBitArray notTransient;
+            //@}
+
+            //* build from exceptions, in rule order
+            void build( const InternalSettingsList& );
+
+            //* rules allowed for given window, or an empty array if all rules are
+            QBitArray allowed( const WindowProperties& ) const;
+        };
+
+        //* window properties that settings resolution depends on
+        struct MemoKey
+        {
+            //* interned window class
+            int classId;
+
+            //* only set if some exception matches window titles
+            QString caption;
+
+            //* only set if some exception is restricted to dialogs
+            int type;
+
+            //*@name only set if some exception uses the matching criterion
+            //@{
+            int windowType;
+            int transient;
+            QString role;
+            QString desktopFileName;
+            //@}
+
+            bool operator == (const MemoKey& other ) const
+            {
+                return classId == other.classId && type == other.type && caption == other.caption &&
+                    windowType == other.windowType && transient == other.transient &&
+                    role == other.role && desktopFileName == other.desktopFileName;
+            }
+        };
+
+        friend uint qHash( const MemoKey& key, uint seed )
+        {
+            return qHash( key.classId, seed ) ^ qHash( key.caption, seed ) ^ uint( key.type ) ^
+                qHash( uint( key.windowType ) << 2 | uint( key.transient ), seed ) ^ qHash( key.role, seed ) ^ qHash( key.desktopFileName, seed );
+        }
+
+        //* maximum number of memoized windows, per thread
+        enum { MaxMemoSize = 512 };
+
+        //* settings published by one reconfigure. Never modified once published
+        struct Snapshot
+        {
+            //* default configuration
+            InternalSettingsPtr defaultSettings;
+
+            //* enabled exceptions as read from config, before validating patterns
+            InternalSettingsList loadedExceptions;
+
+            //* enabled exceptions with a valid pattern, in priority order
+            InternalSettingsList exceptions;
+
+            //* exception patterns, indexed in the same order as exceptions
+            ExceptionMatcher matcher;
+
+            //* true if some enabled exception only applies to dialogs
+            bool hasDialogExceptions = false;
+
+            //* window criteria of exceptions
+            CriteriaIndex criteria;
+
+            //* changes from the previous snapshot
+            Changes changes = AllChanged;
+
+            //* incremented with each published snapshot. Identifies the snapshot resolved settings belong to
+            quint64 generation = 0;
+        };
+
+        using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
+        //* current snapshot. Readers take a reference without locking
+        SnapshotPtr snapshot() const
+        { return m_snapshot.load( std::memory_order_acquire ); }
+
+        //* current snapshot
+        std::atomic<SnapshotPtr> m_snapshot;
+
+        //* serializes reconfigure calls
+        QMutex m_reconfigureMutex;
+
+        //*@name class and type of decorated windows, per window id
+        //@{
+        mutable QMutex m_windowPropertiesMutex;
+        mutable QHash<WId, WindowProperties> m_windowProperties;
+
+        //* windows whose properties are being read
+        mutable QSet<WId> m_pendingWindows;
+        //@}
+
+        //* reads window properties off the main thread, so that the compositor never waits for the X server
+        QThreadPool* m_windowPropertiesPool = nullptr;
 
         //* config object
         KSharedConfigPtr m_config;
 
+        //* delay between the last write to the configuration file and reloading it (ms)
+        enum { ReloadDelay = 250 };
+
+        //* configuration file watcher
+        QFileSystemWatcher* m_watcher = nullptr;
+
+        //* debounce timer for configuration file changes
+        QTimer* m_reloadTimer = nullptr;
+
+        //*@name retries to watch the configuration file, while it is missing
+        //@{
+        enum
+        {
+            //* delay between two attempts (ms)
+            WatchRetryDelay = 100,
+
+            //* attempts before giving up, until the next reconfigure
+            MaxWatchAttempts = 50
+        };
+
+        QTimer* m_watchTimer = nullptr;
+        int m_watchAttempts = 0;
+        //@}
+
+        //* modification time of the configuration file when last seen
+        QDateTime m_configModified;
+
         //* singleton
-        static SettingsProvider *s_self;
+        static QAtomicPointer<SettingsProvider> s_self;
 
     };
 
+    Q_DECLARE_OPERATORS_FOR_FLAGS( SettingsProvider::Changes )
+
 }
 
 #endif
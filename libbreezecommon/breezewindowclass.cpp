@@ -0,0 +1,121 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezewindowclass.h"
+
+#include <QHash>
+#include <QReadWriteLock>
+#include <QVector>
+
+namespace Breeze
+{
+
+    namespace
+    {
+
+        //* interned window classes, shared by all users of the library
+        struct Table
+        {
+            QReadWriteLock lock;
+            QHash<QString, int> ids;
+            QVector<QString> names;
+            QVector<WindowClass::Flags> flags;
+        };
+
+        Table& windowClassTable()
+        {
+            static Table table;
+            return table;
+        }
+
+    }
+
+    //__________________________________________________________________
+    int WindowClass::id( const QString& windowClass )
+    {
+
+        Table& table( windowClassTable() );
+        {
+            QReadLocker locker( &table.lock );
+            const auto iter( table.ids.constFind( windowClass ) );
+            if( iter != table.ids.constEnd() ) return iter.value();
+        }
+
+        // classify outside of the lock, a concurrent insertion is checked below
+        const Flags flags( classify( windowClass ) );
+
+        QWriteLocker locker( &table.lock );
+        const auto iter( table.ids.constFind( windowClass ) );
+        if( iter != table.ids.constEnd() ) return iter.value();
+
+        const int id( table.names.size() );
+        table.ids.insert( windowClass, id );
+        table.names.append( windowClass );
+        table.flags.append( flags );
+        return id;
+
+    }
+
+    //__________________________________________________________________
+    WindowClass::Flags WindowClass::flags( int id )
+    {
+        Table& table( windowClassTable() );
+        QReadLocker locker( &table.lock );
+        return ( id >= 0 && id < table.flags.size() ) ? table.flags[id] : Flags();
+    }
+
+    //__________________________________________________________________
+    QString WindowClass::name( int id )
+    {
+        Table& table( windowClassTable() );
+        QReadLocker locker( &table.lock );
+        return ( id >= 0 && id < table.names.size() ) ? table.names[id] : QString();
+    }
+
+    //__________________________________________________________________
+    WindowClass::Flags WindowClass::classify( const QString& windowClass )
+    {
+
+        static const QVector<QPair<QLatin1String, Flag>> names = {
+            { QLatin1String( "plasma" ), Plasma },
+            { QLatin1String( "krunner" ), Launcher },
+            { QLatin1String( "albert" ), Launcher },
+            { QLatin1String( "ulauncher" ), Launcher },
+            { QLatin1String( "latte-dock" ), Dock },
+            { QLatin1String( "lattedock" ), Dock },
+            { QLatin1String( "plank" ), Dock },
+            { QLatin1String( "cairo-dock" ), Dock },
+            { QLatin1String( "ksplash" ), Session },
+            { QLatin1String( "ksmserver" ), Session },
+            { QLatin1String( "reaper" ), Reaper },
+            { QLatin1String( "konsole" ), Terminal },
+            { QLatin1String( "yakuake" ), Terminal },
+            { QLatin1String( "jetbrains" ), JetBrains }
+        };
+
+        Flags flags;
+        for( const auto& name : names )
+        { if( windowClass.contains( name.first, Qt::CaseInsensitive ) ) flags |= name.second; }
+
+        return flags;
+
+    }
+
+}
@@ -0,0 +1,99 @@
+#ifndef breezewindowclass_h
+#define breezewindowclass_h
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// own
+#include "breezecommon_export.h"
+
+#include <QFlags>
+#include <QString>
+
+namespace Breeze
+{
+
+    //* interned window classes
+    /**
+    each distinct window class string is mapped once to a stable id,
+    together with classification bits matched case insensitively against well known applications.
+    Ids are shared by decorations and the corners effect, and never reused.
+    */
+    class BREEZECOMMON_EXPORT WindowClass
+    {
+
+        public:
+
+        //* classification
+        enum Flag
+        {
+            NoFlag = 0,
+
+            //* plasma shell and its panels
+            Plasma = 1<<0,
+
+            //* launchers: krunner, albert, ulauncher
+            Launcher = 1<<1,
+
+            //* docks: latte, plank, cairo-dock
+            Dock = 1<<2,
+
+            //* splash and session manager
+            Session = 1<<3,
+
+            //* reaper, which draws undecorated main windows
+            Reaper = 1<<4,
+
+            //* terminals with a blurred background: konsole, yakuake
+            Terminal = 1<<5,
+
+            //* jetbrains ides
+            JetBrains = 1<<6,
+
+            //* shell components the corners effect never applies to
+            Shell = Plasma|Launcher|Dock|Session
+        };
+
+        Q_DECLARE_FLAGS( Flags, Flag )
+
+        //* id of given window class, as "name class". Interned on first use
+        static int id( const QString& windowClass );
+
+        //* classification of given window class id
+        static Flags flags( int id );
+
+        //* classification of given window class
+        static Flags flags( const QString& windowClass )
+        { return flags( id( windowClass ) ); }
+
+        //* window class of given id
+        static QString name( int id );
+
+        private:
+
+        //* classify a new window class
+        static Flags classify( const QString& windowClass );
+
+    };
+
+    Q_DECLARE_OPERATORS_FOR_FLAGS( WindowClass::Flags )
+
+}
+
+#endif